@@ -53,6 +53,75 @@ using TaskPrio = std::uint8_t;
 //! SST internal event-queue counter
 using QCtr = std::uint8_t;
 
+//! SST timestamp (free-running counter, wraps around)
+using Timestamp = std::uint32_t;
+
+class Task; // forward declaration
+
+#ifdef SST_EVT_POOL
+//! SST buffer-descriptor event allocated from a BlockPool
+//!
+//! @details
+//! The descriptor occupies the beginning of the pool block and the rest of
+//! the block is the payload buffer, so the data is never copied. Posting
+//! the event transfers its ownership to the recipient and the block returns
+//! to the pool automatically after the last recipient dispatched it.
+struct BufEvt : public Evt {
+    std::uint8_t refCtr_;  //!< # references (internal use only)
+    std::uint8_t reserved_;
+    std::uint32_t len;     //!< # bytes of the payload used
+
+    std::uint8_t *data(void) noexcept {
+        return reinterpret_cast<std::uint8_t *>(this + 1);
+    }
+    std::uint8_t const *data(void) const noexcept {
+        return reinterpret_cast<std::uint8_t const *>(this + 1);
+    }
+};
+#endif
+
+#ifdef SST_EVT_DEADLINE
+//! callback invoked when an event is dispatched past its deadline
+using DeadlineMissHandler = void (*)(
+    Task * const task,
+    Evt const * const e,
+    Timestamp const late);
+#endif
+
+#ifdef SST_TASK_BUDGET
+//! policy applied when a task activation overruns its execution budget
+enum BudgetPolicy : std::uint8_t {
+    BUDGET_COUNT,  //!< only count the overruns
+    BUDGET_NOTIFY, //!< count and post an event to a supervisor task
+    BUDGET_FAULT   //!< count and invoke the DBC fault handler
+};
+#endif
+
+#ifdef SST_LATENCY
+#ifndef SST_LATENCY_NBIN
+#define SST_LATENCY_NBIN 16U
+#endif
+
+//! post-time stamp of a queued event (for the latency measurement)
+struct LatencyStamp {
+    Timestamp ts;           //!< timestamp of the post
+    std::uint16_t producer; //!< context of the post (SST_PORT_CONTEXT_ID())
+};
+
+//! latency histogram for a (producer, task, signal) combination
+struct LatencyHist {
+    Task const *task;        //!< receiving task (nullptr for unused)
+    std::uint16_t producer;  //!< posting context (SST_PORT_CONTEXT_ID())
+    Signal sig;              //!< signal of the events
+    std::uint32_t nSamples;  //!< # measured latencies
+    Timestamp min;           //!< minimum latency
+    Timestamp max;           //!< maximum latency
+    std::uint64_t sum;       //!< sum of the latencies (for the mean)
+    //! bins[k] counts latencies in [2^k, 2^(k+1)) (the last bin: above)
+    std::uint32_t bins[SST_LATENCY_NBIN];
+};
+#endif
+
 //! SST Task (a.k.a. "Active Object")
 class Task {
 private:
@@ -62,17 +131,139 @@ private:
     QCtr m_tail;  //!< index for removing events
     QCtr m_nUsed; //!< # used entries currently in the queue
 
+#ifdef SST_EVT_DEADLINE
+    Timestamp *m_dlBuf; //!< deadlines of the queued events (0 for none)
+    std::uint16_t m_nMissed; //!< # events dispatched past the deadline
+
+    void checkDeadline_(Evt const * const e, Timestamp const dl) noexcept;
+#endif
+
+#ifdef SST_TASK_BUDGET
+    Timestamp m_budget;  //!< execution budget per activation (0 for none)
+    Timestamp m_start;   //!< timestamp at the entry to the activation
+    Timestamp m_preempt; //!< time preempted in the current activation
+    Task *m_preempted;   //!< task preempted by the current activation
+    Task *m_supervisor;  //!< task notified of the overruns
+    Evt const *m_overrunEvt;   //!< event posted to the supervisor
+    std::uint16_t m_nOverruns; //!< # activations over the budget
+    BudgetPolicy m_policy;     //!< policy applied on the overrun
+    bool m_overrun;            //!< current activation over the budget?
+
+    void budgetEnter_(void) noexcept;
+    void budgetExit_(void) noexcept;
+    void overrun_(void) noexcept;
+#endif
+
+#ifdef SST_LATENCY
+    LatencyStamp *m_latBuf; //!< post stamps of the queued events
+
+    void recordLatency_(Evt const * const e,
+                        LatencyStamp const &stamp) noexcept;
+#endif
+
+#ifdef SST_QUEUE_WATERMARK
+    Task *m_wmProducer;    //!< producer resumed at the low-watermark
+    Evt const *m_resumeEvt; //!< event posted to the producer
+    QCtr m_lowWatermark;   //!< level resuming the producer
+    QCtr m_highWatermark;  //!< level throttling the producer
+    bool m_throttled;      //!< queue above the low-watermark?
+
+    bool drained_(void) noexcept;
+#endif
+
+#ifdef SST_SIG_FILTER
+    std::uint32_t *m_sigMask; //!< bitmap of the accepted signals
+    Signal m_nSig;            //!< # signals covered by m_sigMask
+    std::uint16_t m_nFiltered; //!< # posted events not accepted
+
+    bool filter_(Evt const * const e) noexcept;
+#endif
+
+#ifdef SST_SIG_COALESCE
+    std::uint32_t *m_coalMask; //!< bitmap of the "at most one" signals
+    std::uint32_t *m_coalPend; //!< bitmap of those signals in the queue
+    Signal m_coalNSig;         //!< # signals covered by the bitmaps
+    std::uint16_t m_nCoalesced; //!< # posted events suppressed
+
+    bool coalesce_(Evt const * const e) noexcept;
+    void unpend_(Evt const * const e) noexcept;
+#endif
+
+#if (defined SST_SIG_FILTER) || (defined SST_SIG_COALESCE)
+    void discard_(Evt const * const e) noexcept;
+#endif
+
 #ifdef SST_PORT_TASK_ATTR
     SST_PORT_TASK_ATTR
 #endif
 
 public:
+    Task(void) noexcept;
     void start(
         TaskPrio prio,
         Evt const **qBuf, QCtr qLen,
         Evt const * const ie);
 
     void post(Evt const * const e) noexcept;
+    void postLIFO(Evt const * const e) noexcept;
+
+    //! length of the event queue (0 before start())
+    QCtr getQLen(void) const noexcept {
+        return (m_qBuf != nullptr) ? static_cast<QCtr>(m_end + 1U) : 0U;
+    }
+
+#ifdef SST_EVT_POOL
+    //! post the buffer event and give up the ownership (@p e set to nullptr)
+    void post(BufEvt *&e) noexcept {
+        post(static_cast<Evt const *>(e));
+        e = nullptr; // the producer must not access the buffer anymore
+    }
+#endif
+
+#ifdef SST_EVT_DEADLINE
+    // deadline monitoring of the posted events
+    void setDeadlineBuf(Timestamp * const dlBuf) noexcept;
+    void post(Evt const * const e, Timestamp const budget) noexcept;
+    std::uint16_t getNMissed(void) const noexcept { return m_nMissed; }
+#endif
+
+#ifdef SST_TASK_BUDGET
+    // execution-time budget of the task activations
+    void setBudget(Timestamp const budget, BudgetPolicy const policy,
+                   Task * const supervisor = nullptr,
+                   Evt const * const overrunEvt = nullptr) noexcept;
+    std::uint16_t getNOverruns(void) const noexcept { return m_nOverruns; }
+    static void checkBudget(void) noexcept;
+#endif
+
+#ifdef SST_LATENCY
+    // post-to-dispatch latency measurement of the posted events
+    void setLatencyBuf(LatencyStamp * const latBuf) noexcept;
+#endif
+
+#ifdef SST_QUEUE_WATERMARK
+    // low-watermark flow control of the producer posting to this task
+    void setWatermarks(QCtr const low, QCtr const high,
+                       Task * const producer,
+                       Evt const * const resumeEvt) noexcept;
+    bool isThrottled(void) const noexcept { return m_throttled; }
+#endif
+
+#ifdef SST_SIG_FILTER
+    // signal filter applied to the events posted to this task
+    void setSigFilter(std::uint32_t * const mask, Signal const nSig) noexcept;
+    void acceptSig(Signal const sig) noexcept;
+    void ignoreSig(Signal const sig) noexcept;
+    std::uint16_t getNFiltered(void) const noexcept { return m_nFiltered; }
+#endif
+
+#ifdef SST_SIG_COALESCE
+    // suppression of the duplicate signals in the queue
+    void setCoalesceBuf(std::uint32_t * const mask, std::uint32_t * const pend,
+                        Signal const nSig) noexcept;
+    void coalesceSig(Signal const sig) noexcept;
+    std::uint16_t getNCoalesced(void) const noexcept { return m_nCoalesced; }
+#endif
 
     virtual void init(Evt const * const ie) = 0;
     virtual void dispatch(Evt const * const e) = 0;
@@ -88,9 +279,98 @@ public:
 #endif
 };
 
+// SST Deferred Event facilities --------------------------------------------
+//! SST deferred-event queue
+//!
+//! @details
+//! The deferred-event queue holds pointers to events that the owner task
+//! cannot handle in its current state. The events are neither copied nor
+//! consumed, so they remain valid until they are recalled (a deferred
+//! BufEvt keeps its pool block). Both defer() and recall() are O(1) and
+//! must be called only from the owner task.
+class DeferQueue {
+private:
+    Evt const **m_qBuf; //!< ring buffer for the deferred events
+    Task *m_task; //!< the owner task to recall the events to
+    QCtr m_end;   //!< last index in the ring buffer
+    QCtr m_head;  //!< index for inserting events
+    QCtr m_tail;  //!< index for removing events
+    QCtr m_nUsed; //!< # used entries currently in the queue
+
+public:
+    DeferQueue(Task *task, Evt const **qBuf, QCtr qLen);
+    bool defer(Evt const * const e) noexcept;
+    bool recall(void) noexcept;
+    QCtr getNUsed(void) const noexcept { return m_nUsed; }
+};
+
+#ifdef SST_EVT_POOL
+// SST Event Pool facilities -------------------------------------------------
+//! SST pool of fixed-size blocks for the buffer-descriptor events
+//!
+//! @details
+//! The free blocks are kept in a singly-linked list, so allocation and
+//! release are O(1). The event recycling locates the pool of an event by
+//! its address, so any event outside of all pools is never recycled.
+class BlockPool {
+public:
+    void init(void * const sto, std::uint32_t const stoSize,
+              std::uint32_t const blockSize);
+    BufEvt *alloc(Signal const sig) noexcept;
+    std::uint32_t getBufSize(void) const noexcept {
+        return m_blockSize - static_cast<std::uint32_t>(sizeof(BufEvt));
+    }
+    std::uint16_t getNFree(void) const noexcept { return m_nFree; }
+    std::uint16_t getNMin(void) const noexcept { return m_nMin; }
+
+private:
+    BlockPool *m_next;    //!< next registered pool
+    void *m_free;         //!< head of the list of free blocks
+    std::uint8_t *m_start; //!< beginning of the pool storage
+    std::uint8_t *m_end;  //!< end of the pool storage
+    std::uint32_t m_blockSize; //!< size of a block [bytes]
+    std::uint16_t m_nTot;  //!< total # blocks
+    std::uint16_t m_nFree; //!< # free blocks
+    std::uint16_t m_nMin;  //!< minimum # free blocks so far
+
+    static BlockPool *find_(Evt const * const e) noexcept;
+    static void ref_(Evt const * const e) noexcept;
+
+    // the event recycling facilities
+    friend class Task;
+    friend class DeferQueue;
+    friend class PipeLink;
+    friend class TimeoutPool;
+    friend void gc(Evt const * const e) noexcept;
+};
+
+//! recycle the event (return a buffer event to its pool when unused)
+void gc(Evt const * const e) noexcept;
+#endif // SST_EVT_POOL
+
 // SST Time Event facilities -------------------------------------------------
+#ifndef SST_TIMEEVT_CTR_SIZE
+//! size of the SST time-event tick counters [bytes] (2U or 4U)
+#define SST_TIMEEVT_CTR_SIZE 2U
+#endif
+
+#if (SST_TIMEEVT_CTR_SIZE == 2U)
 //! SST internal time-event tick counter
 using TCtr = std::uint16_t;
+#elif (SST_TIMEEVT_CTR_SIZE == 4U)
+//! SST internal time-event tick counter
+using TCtr = std::uint32_t;
+#else
+#error "SST_TIMEEVT_CTR_SIZE defined incorrectly, expected 2U or 4U"
+#endif
+
+#ifndef SST_MAX_TICK_DOMAIN
+//! maximum number of independent tick domains (tick rates)
+#define SST_MAX_TICK_DOMAIN 1U
+#endif
+
+//! SST tick domain, each with its own list of time events and tick()
+using TickDomain = std::uint8_t;
 
 //! SST time event class
 class TimeEvt : public Evt {
@@ -99,15 +379,170 @@ private:
     Task *m_task;    //! the owner task to post time event to
     TCtr m_ctr;      //! time event down-counter
     TCtr m_interval; //! interval for periodic time event
+    TickDomain m_domain; //! the tick domain of this time event
+    std::uint16_t m_stagger; //! index of armStaggered() (0xFFFF for none)
+    std::uint8_t m_tick; //! low byte of the last tick processed by tick()
+
+    TCtr lastTick_(void) const noexcept;
 
 public:
-    TimeEvt(Signal sig, Task *task);
+    TimeEvt(Signal sig, Task *task, TickDomain domain = 0U);
     void arm(TCtr ctr, TCtr interval);
+    void armAt(TCtr tick, TCtr interval);
+    void armPhase(TCtr interval, TCtr phase);
+    void armStaggered(TCtr interval);
     bool disarm(void);
 
-    static void tick(void);
+    static void tick(TickDomain const domain = 0U);
+    static TCtr getTickCtr(TickDomain const domain = 0U) noexcept;
 };
 
+//! SST time callback (periodic or one-shot function call without event)
+//!
+//! @details
+//! Upon expiration, the time callback calls the provided function
+//! directly from TimeEvt::tick() of its tick domain, without posting any
+//! event and activating any task. The callback thus runs in the context
+//! that calls the tick processing of the domain: either in the tick ISR,
+//! or batched with other callbacks at the priority of a SST::TickTask.
+//! The callback must be short and must not block.
+class TimeCb {
+public:
+    //! the callback function type
+    using Callback = void (*)(void *par);
+
+    TimeCb(Callback cb, void *par, TickDomain domain = 0U);
+    void arm(TCtr ctr, TCtr interval);
+    bool disarm(void);
+
+private:
+    friend class TimeEvt;
+
+    TimeCb *m_next;  //!< link to next time callback in a link-list
+    Callback m_cb;   //!< the function to call upon expiration
+    void *m_par;     //!< the parameter for the function
+    TCtr m_ctr;      //!< time callback down-counter
+    TCtr m_interval; //!< interval for periodic time callback
+};
+
+//! SST one-shot timeout, allocated from a SST::TimeoutPool
+class Timeout {
+private:
+    friend class TimeoutPool;
+
+    Timeout *m_next;    //!< next timeout in the armed or free list
+    Timeout *m_prev;    //!< previous timeout in the armed list
+    Task *m_task;       //!< the task to post the event to
+    Evt const *m_evt;   //!< the event to post upon expiration
+    TCtr m_ctr;         //!< timeout down-counter (0 when free)
+    std::uint16_t m_gen; //!< generation, incremented upon every release
+};
+
+//! SST pool of one-shot timeouts with O(1) arm and cancel
+//!
+//! @details
+//! The armed timeouts are kept in a doubly-linked list, which is
+//! scanned by TimeEvt::tick() of the tick domain of the pool. Therefore
+//! the cost of the tick processing is proportional only to the number of
+//! the currently armed timeouts. A timeout returns to the pool
+//! automatically when it expires or when it is canceled.
+//!
+//! @note
+//! The timeout posts the provided event, which is not owned by the
+//! pool. The event must stay valid until it is dispatched. With
+//! SST_EVT_POOL, an armed timeout holds a reference to a buffer event,
+//! so a canceled buffer event returns to its pool.
+class TimeoutPool {
+public:
+    //! handle of an armed timeout (0 is never a valid handle, so
+    //! cancel() of the handle 0 returns false)
+    using Handle = std::uint32_t;
+
+    void init(Timeout * const sto, std::uint16_t const len,
+              TickDomain const domain = 0U);
+    Handle arm(Task * const task, Evt const * const e,
+               TCtr const ctr) noexcept;
+    bool cancel(Handle const h) noexcept;
+    std::uint16_t getNFree(void) const noexcept { return m_nFree; }
+    std::uint16_t getNMin(void) const noexcept { return m_nMin; }
+
+    static void tick(TickDomain const domain);
+
+private:
+    TimeoutPool *m_next;  //!< next pool in the same tick domain
+    Timeout *m_sto;       //!< storage for the timeouts
+    Timeout *m_armed;     //!< head of the list of armed timeouts
+    Timeout *m_free;      //!< head of the list of free timeouts
+    Timeout *m_cursor;    //!< next armed timeout to process in tick()
+    std::uint16_t m_len;  //!< # timeouts in the storage
+    std::uint16_t m_nFree; //!< # free timeouts
+    std::uint16_t m_nMin;  //!< minimum # free timeouts so far
+
+    void release_(Timeout * const t) noexcept;
+};
+
+//! SST task for processing the clock ticks of a tick domain at task level
+//!
+//! @details
+//! Instead of calling TimeEvt::tick() directly, the tick ISR calls
+//! TickTask::tick(), which only counts the elapsed ticks and activates
+//! the TickTask when needed. The TimeEvt::tick() processing then runs at
+//! the SST priority of the TickTask, so that it does not delay the tasks
+//! of higher priority. Like any other SST task, the TickTask needs to be
+//! assigned an IRQ by the port-specific means before it is started.
+class TickTask : public Task {
+private:
+    Evt const *m_qSto[1]; //!< queue storage for the tick requests
+    TCtr m_nTicks;        //!< # elapsed ticks not processed yet
+    TickDomain m_domain;  //!< the tick domain processed by this task
+
+public:
+    explicit TickTask(TickDomain domain = 0U);
+    void start(TaskPrio prio);
+    void tick(void) noexcept;
+
+    void init(Evt const * const ie) override;
+    void dispatch(Evt const * const e) override;
+};
+
+// SST Timestamp facilities --------------------------------------------------
+#ifndef SST_PORT_TIMESTAMP
+#if (SST_TIMEEVT_CTR_SIZE == 4U)
+// without a port-specific timestamp, use the tick counter of domain 0
+#define SST_PORT_TIMESTAMP() (SST::TimeEvt::getTickCtr())
+#endif
+#endif
+
+#ifdef SST_EVT_DEADLINE
+#ifndef SST_PORT_TIMESTAMP
+#error "SST_EVT_DEADLINE requires SST_PORT_TIMESTAMP or 32-bit TCtr"
+#endif
+void setDeadlineMonitor(
+    std::uint16_t * const sigCtrs, Signal const nSig,
+    DeadlineMissHandler const handler) noexcept;
+#endif
+
+#ifdef SST_TASK_BUDGET
+#ifndef SST_PORT_TIMESTAMP
+#error "SST_TASK_BUDGET requires SST_PORT_TIMESTAMP or 32-bit TCtr"
+#endif
+#endif
+
+#ifdef SST_LATENCY
+#ifndef SST_PORT_TIMESTAMP
+#error "SST_LATENCY requires SST_PORT_TIMESTAMP or 32-bit TCtr"
+#endif
+#ifndef SST_PORT_CONTEXT_ID
+// without a port-specific context ID, all producers are reported as 0
+#define SST_PORT_CONTEXT_ID() (0U)
+#endif
+// NOTE: the histograms are searched without the critical section, so
+// setLatencyHist() must be called when no task activation is running
+void setLatencyHist(LatencyHist * const hist,
+                    std::uint16_t const len) noexcept;
+std::uint32_t getLatencyNLost(void) noexcept;
+#endif
+
 // SST Kernel facilities -----------------------------------------------------
 void init(void);
 void start(void);
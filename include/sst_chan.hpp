@@ -0,0 +1,87 @@
+//============================================================================
+// Super-Simple Tasker (SST/C++)
+//
+// Copyright (C) 2006-2023 Quantum Leaps, <state-machine.com>.
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//============================================================================
+#ifndef SST_CHAN_HPP_
+#define SST_CHAN_HPP_
+
+#include "sst.hpp" // Super-Simple Tasker (SST/C++)
+
+namespace SST {
+
+// SST Buffer Channel facilities ---------------------------------------------
+//! SST double-buffer (ping-pong) or N-buffer channel for sample blocks
+//!
+//! @details
+//! The channel rotates N fixed-size blocks (in one contiguous storage)
+//! between a single producer (typically an ISR or DMA-complete ISR) and
+//! a single consumer task. The producer fills the block returned by
+//! getFillBuf() and calls swap() when the block is complete, which hands
+//! the block over to the consumer and posts the provided event (once per
+//! block). The consumer processes the oldest ready block with acquire()
+//! and returns it to the producer with release(). No data is copied.
+//!
+//! The producer never blocks. If all other blocks are still held by the
+//! consumer, swap() reports an overrun: the just-filled block is dropped
+//! and the producer refills the same block.
+//!
+//! Up to N-1 "block ready" events can be queued to the consumer at once,
+//! so the queue of the consumer task must hold at least N-1 events (in
+//! addition to any other events posted to the task). The constructor
+//! asserts it when the consumer task is already started.
+class BufChan {
+public:
+    BufChan(void * const sto, std::uint32_t const blockSize,
+            std::uint8_t const nBlocks,
+            Task * const task, Evt const * const e);
+
+    // producer side (single producer)
+    void *getFillBuf(void) const noexcept {
+        return m_sto + (m_fill * m_blockSize);
+    }
+    bool swap(void) noexcept;
+
+    // consumer side (the task)
+    void const *acquire(void) const noexcept;
+    void release(void) noexcept;
+
+    std::uint32_t getBlockSize(void) const noexcept { return m_blockSize; }
+    std::uint8_t getNReady(void) const noexcept { return m_nReady; }
+    std::uint32_t getNOverruns(void) const noexcept { return m_nOverruns; }
+
+private:
+    std::uint8_t *m_sto;        //!< storage of the blocks
+    Task *m_task;               //!< the consumer task
+    Evt const *m_evt;           //!< "block ready" event
+    std::uint32_t m_blockSize;  //!< size of each block [bytes]
+    std::uint8_t m_nBlocks;     //!< # blocks
+    std::uint8_t m_fill;        //!< block filled by the producer
+    std::uint8_t m_rd;          //!< oldest block held by the consumer
+    std::uint8_t volatile m_nReady; //!< # blocks held by the consumer
+    std::uint32_t m_nOverruns;  //!< # blocks dropped due to overruns
+};
+
+} // namespace SST
+
+#endif // SST_CHAN_HPP_
@@ -0,0 +1,194 @@
+//============================================================================
+// Super-Simple Tasker (SST/C++)
+//
+// Copyright (C) 2006-2023 Quantum Leaps, <state-machine.com>.
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//============================================================================
+#ifndef SST_EVT_HPP_
+#define SST_EVT_HPP_
+
+#include <cstddef>  // std::size_t
+#include "sst.hpp"  // Super-Simple Tasker (SST/C++)
+
+namespace SST {
+
+// SST typed event facilities ------------------------------------------------
+//! SST event with the signal and payload type bound at compile time
+template<Signal SIG_, typename P_ = void>
+struct EvtT : public Evt {
+    static constexpr Signal SIG = SIG_; //!< the signal of this event type
+    P_ payload; //!< event parameters
+
+    constexpr explicit EvtT(P_ const &p)
+      : Evt{SIG_}, payload(p)
+    {}
+};
+
+//! SST event with the signal bound at compile time and no payload
+template<Signal SIG_>
+struct EvtT<SIG_, void> : public Evt {
+    static constexpr Signal SIG = SIG_; //!< the signal of this event type
+
+    constexpr EvtT()
+      : Evt{SIG_}
+    {}
+};
+
+//! registration of the member-function handler `H_` for the typed event
+//! `EVT_` (an EvtT<> instance) in the SST::EvtDispatch table
+template<typename ME_, typename EVT_, void (ME_::*H_)(EVT_ const * const e)>
+struct On {
+    static constexpr Signal SIG = EVT_::SIG;
+
+    static void handle(ME_ * const me, Evt const * const e) {
+        // NOTE: the downcast is safe, because the dispatch table
+        // calls this handler only for events with the signal EVT_::SIG
+        (me->*H_)(static_cast<EVT_ const *>(e));
+    }
+};
+
+//! registration of the member-function handler `H_` for the signal `SIG_`
+//! of events without payload (e.g., SST::TimeEvt)
+template<typename ME_, Signal SIG_, void (ME_::*H_)(Evt const * const e)>
+struct OnSig {
+    static constexpr Signal SIG = SIG_;
+
+    static void handle(ME_ * const me, Evt const * const e) {
+        (me->*H_)(e);
+    }
+};
+
+//! SST dispatch table built at compile time from the handler
+//! registrations `ONS_` (SST::On<> and SST::OnSig<>)
+//!
+//! @details
+//! The table is a dense array of handlers indexed by the signal offset
+//! from the lowest registered signal, so dispatching an event costs one
+//! bounds check and one indirect call, regardless of how sparse the
+//! signals are or how many handlers are registered.
+//!
+//! @par Example
+//! @code
+//! using Table = SST::EvtDispatch<Blinky,
+//!     SST::On<Blinky, BlinkyWorkEvt, &Blinky::onWork>,
+//!     SST::OnSig<Blinky, TIMEOUT_SIG, &Blinky::onTimeout>>;
+//!
+//! void Blinky::dispatch(SST::Evt const * const e) {
+//!     if (!Table::dispatch(this, e)) {
+//!         DBC_ERROR(500); // unexpected event
+//!     }
+//! }
+//! @endcode
+template<typename ME_, typename... ONS_>
+class EvtDispatch {
+public:
+    static bool dispatch(ME_ * const me, Evt const * const e) {
+        // NOTE: signals below MIN_SIG wrap around to large offsets
+        Signal const i = static_cast<Signal>(e->sig - MIN_SIG);
+        if ((i < LEN) && (table_.handlers[i] != nullptr)) {
+            (*table_.handlers[i])(me, e);
+            return true;
+        }
+        return false;
+    }
+
+private:
+    using Handler = void (*)(ME_ * const me, Evt const * const e);
+
+    template<typename... ONS2_>
+    struct Regs_;
+    template<typename ON_, typename... ONS2_>
+    struct Regs_<ON_, ONS2_...> {
+        static constexpr Signal min(void) {
+            return (ON_::SIG < Regs_<ONS2_...>::min())
+                   ? ON_::SIG : Regs_<ONS2_...>::min();
+        }
+        static constexpr Signal max(void) {
+            return (ON_::SIG > Regs_<ONS2_...>::max())
+                   ? ON_::SIG : Regs_<ONS2_...>::max();
+        }
+        static constexpr std::size_t count(Signal const sig) {
+            return ((ON_::SIG == sig) ? 1U : 0U)
+                   + Regs_<ONS2_...>::count(sig);
+        }
+        static constexpr bool unique(void) {
+            return (Regs_<ONS2_...>::count(ON_::SIG) == 0U)
+                   && Regs_<ONS2_...>::unique();
+        }
+        static constexpr Handler find(Signal const sig) {
+            return (ON_::SIG == sig)
+                   ? &ON_::handle : Regs_<ONS2_...>::find(sig);
+        }
+    };
+    template<typename ON_>
+    struct Regs_<ON_> { // recursion terminator for a single registration
+        static constexpr Signal min(void) { return ON_::SIG; }
+        static constexpr Signal max(void) { return ON_::SIG; }
+        static constexpr std::size_t count(Signal const sig) {
+            return (ON_::SIG == sig) ? 1U : 0U;
+        }
+        static constexpr bool unique(void) { return true; }
+        static constexpr Handler find(Signal const sig) {
+            return (ON_::SIG == sig) ? &ON_::handle : nullptr;
+        }
+    };
+
+    using All_ = Regs_<ONS_...>;
+
+    static_assert(sizeof...(ONS_) > 0U,
+                  "at least one handler must be registered");
+    static_assert(All_::unique(),
+                  "each signal can be registered only once");
+
+    static constexpr Signal MIN_SIG = All_::min();
+    static constexpr std::size_t LEN = All_::max() - All_::min() + 1U;
+
+    template<std::size_t... IS_>
+    struct Seq_ {};
+    template<std::size_t N_, std::size_t... IS_>
+    struct MakeSeq_ : MakeSeq_<N_ - 1U, N_ - 1U, IS_...> {};
+    template<std::size_t... IS_>
+    struct MakeSeq_<0U, IS_...> {
+        using type = Seq_<IS_...>;
+    };
+
+    struct Table_ {
+        Handler handlers[LEN];
+    };
+    template<std::size_t... IS_>
+    static constexpr Table_ make_(Seq_<IS_...>) {
+        return Table_{{ All_::find(static_cast<Signal>(MIN_SIG + IS_))... }};
+    }
+
+    static Table_ const table_;
+};
+
+template<typename ME_, typename... ONS_>
+constexpr typename EvtDispatch<ME_, ONS_...>::Table_
+    EvtDispatch<ME_, ONS_...>::table_ =
+        EvtDispatch<ME_, ONS_...>::make_(
+            typename EvtDispatch<ME_, ONS_...>::template MakeSeq_<
+                EvtDispatch<ME_, ONS_...>::LEN>::type{});
+
+} // namespace SST
+
+#endif // SST_EVT_HPP_
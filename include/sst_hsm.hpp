@@ -0,0 +1,199 @@
+//============================================================================
+// Super-Simple Tasker (SST/C++)
+//
+// Copyright (C) 2006-2023 Quantum Leaps, <state-machine.com>.
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//============================================================================
+#ifndef SST_HSM_HPP_
+#define SST_HSM_HPP_
+
+#include "sst.hpp" // Super-Simple Tasker (SST/C++)
+
+namespace SST {
+
+// SST Hierarchical State Machine facilities ---------------------------------
+//! SST hierarchical state machine (HSM) task
+//!
+//! @details
+//! The state hierarchy is described by a constant table of Hsm::State
+//! indexed by the state identifiers, where the entry [Hsm::TOP] is the
+//! top state and its `init` member designates the initial state.
+//! Transitions are described by Hsm::Tran objects precomputed at compile
+//! time with Hsm::path(), so taking a transition executes only the exit
+//! and entry actions without any runtime search for the least common
+//! ancestor (LCA) of the source and target states.
+//!
+//! @par Example
+//! @code
+//! constexpr SST::Hsm::State Blinky::states[] = {
+//!     // parent,    init, entry,      exit,     handler
+//!     { TOP,        OFF,  nullptr,    nullptr,  nullptr    }, // TOP
+//!     { TOP,        TOP,  &off_entry, nullptr,  &off_handle }, // OFF
+//!     { TOP,        TOP,  &on_entry,  &on_exit, &on_handle  }, // ON
+//! };
+//! constexpr SST::Hsm::Tran Blinky::off2on = path(states, OFF, ON);
+//! @endcode
+class Hsm : public Task {
+public:
+    //! state identifier (index into the state table)
+    using StateId = std::uint8_t;
+    enum : StateId {
+        TOP = 0U //!< identifier of the top state
+    };
+
+    //! status returned from the state handlers
+    enum Status : std::uint8_t {
+        HANDLED,   //!< event handled (internal transition)
+        UNHANDLED, //!< event not handled, propagate to the superstate
+        TRAN       //!< event handled, transition to be taken
+    };
+
+    //! state handler (event processing with guards)
+    using Handler = Status (*)(Hsm * const me, Evt const * const e);
+
+    //! entry/exit action
+    using Action = void (*)(Hsm * const me);
+
+    //! state table entry
+    struct State {
+        StateId parent;  //!< superstate (Hsm::TOP for top-level states)
+        StateId init;    //!< initial direct substate (Hsm::TOP if none)
+        Action  entry;   //!< entry action (nullptr if none)
+        Action  exit;    //!< exit action (nullptr if none)
+        Handler handler; //!< event handler (nullptr if none)
+    };
+
+    //! transition path precomputed at compile time by Hsm::path()
+    struct Tran {
+        StateId source;      //!< the state handling the transition
+        StateId target;      //!< the main target of the transition
+        std::uint8_t nExit;  //!< # states to exit, starting with source
+        std::uint8_t nEntry; //!< # states to enter, ending with target
+        std::uint64_t entry; //!< packed states to enter, outermost first
+    };
+
+    //! compute the transition path from `source` to `target`
+    //!
+    //! @note
+    //! A self-transition exits and re-enters the source. A transition
+    //! to a substate does not exit the source and a transition to
+    //! a superstate does not exit the target (like in QP).
+    //! The entry path can be at most 8 states long, which is checked
+    //! at compile time.
+    static constexpr Tran path(
+        State const * const states,
+        StateId source, StateId target)
+    {
+        return path_(states, source, target,
+            (source == target)
+                ? states[source].parent
+                : lca_(states, source, target));
+    }
+
+    void dispatch(Evt const * const e) override final;
+
+    Status tran(Tran const &t) noexcept {
+        m_tran = &t;
+        return TRAN;
+    }
+    StateId getState(void) const noexcept { return m_state; }
+    bool isIn(StateId const s) const noexcept;
+
+protected:
+    explicit Hsm(State const * const states) noexcept;
+
+    // take the top-most initial transition, to be called from init()
+    void enterInitial(void);
+
+private:
+    State const *m_states; //!< the state table
+    Tran const *m_tran;    //!< the transition requested by a handler
+    StateId m_state;       //!< the current (leaf) state
+
+    StateId drill_(StateId s);
+
+    // constexpr helpers for computing the transition paths...
+    static constexpr std::uint8_t depth_(
+        State const * const states, StateId s)
+    {
+        return (s == TOP)
+            ? 0U
+            : static_cast<std::uint8_t>(
+                  1U + depth_(states, states[s].parent));
+    }
+    static constexpr StateId ancestor_(
+        State const * const states, StateId s, std::uint8_t n)
+    {
+        return (n == 0U)
+            ? s
+            : ancestor_(states, states[s].parent,
+                        static_cast<std::uint8_t>(n - 1U));
+    }
+    static constexpr StateId lcaEq_(
+        State const * const states, StateId a, StateId b)
+    {
+        return (a == b)
+            ? a
+            : lcaEq_(states, states[a].parent, states[b].parent);
+    }
+    static constexpr StateId lca_(
+        State const * const states, StateId a, StateId b)
+    {
+        return lcaEq_(states,
+            ancestor_(states, a, (depth_(states, a) > depth_(states, b))
+                ? static_cast<std::uint8_t>(
+                      depth_(states, a) - depth_(states, b))
+                : 0U),
+            ancestor_(states, b, (depth_(states, b) > depth_(states, a))
+                ? static_cast<std::uint8_t>(
+                      depth_(states, b) - depth_(states, a))
+                : 0U));
+    }
+    static constexpr std::uint64_t pack_(
+        State const * const states, StateId s, std::uint8_t n)
+    {
+        return (n == 0U)
+            ? 0U
+            : (pack_(states, states[s].parent,
+                     static_cast<std::uint8_t>(n - 1U))
+               | (static_cast<std::uint64_t>(s) << (8U * (n - 1U))));
+    }
+    static constexpr Tran path_(
+        State const * const states,
+        StateId source, StateId target, StateId lca)
+    {
+        return Tran {
+            source,
+            target,
+            static_cast<std::uint8_t>(
+                depth_(states, source) - depth_(states, lca)),
+            static_cast<std::uint8_t>(
+                depth_(states, target) - depth_(states, lca)),
+            pack_(states, target, static_cast<std::uint8_t>(
+                depth_(states, target) - depth_(states, lca)))
+        };
+    }
+};
+
+} // namespace SST
+
+#endif // SST_HSM_HPP_
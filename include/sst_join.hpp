@@ -0,0 +1,69 @@
+//============================================================================
+// Super-Simple Tasker (SST/C++)
+//
+// Copyright (C) 2006-2023 Quantum Leaps, <state-machine.com>.
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//============================================================================
+#ifndef SST_JOIN_HPP_
+#define SST_JOIN_HPP_
+
+#include "sst.hpp" // Super-Simple Tasker (SST/C++)
+
+namespace SST {
+
+// SST Join Barrier facilities -----------------------------------------------
+//! SST fan-out/fan-in join barrier
+//!
+//! @details
+//! The coordinator task arms the barrier with the number of expected
+//! completions and then fans the work out to the worker tasks. Each
+//! worker calls done() when its part is finished (at any priority, also
+//! from an ISR), and the last one posts the single "all done" event to
+//! the coordinator, so the coordinator is not activated for each of the
+//! partial completions. The workers can report a failure with done(false),
+//! which the coordinator checks with getNFailed().
+//!
+//! @note
+//! The barrier must be armed before the work is fanned out, because a
+//! worker of higher priority completes before the coordinator proceeds.
+class JoinBarrier {
+public:
+    JoinBarrier(Task * const coordinator, Evt const * const doneEvt);
+
+    // coordinator side
+    void arm(std::uint16_t const n) noexcept;
+    std::uint16_t getNPending(void) const noexcept { return m_nPending; }
+    std::uint16_t getNFailed(void) const noexcept { return m_nFailed; }
+
+    // worker side
+    void done(bool const ok = true) noexcept;
+
+private:
+    Task *m_coordinator;   //!< the task notified when all are done
+    Evt const *m_doneEvt;  //!< "all done" event
+    std::uint16_t volatile m_nPending; //!< # completions still expected
+    std::uint16_t m_nFailed; //!< # completions reporting a failure
+};
+
+} // namespace SST
+
+#endif // SST_JOIN_HPP_
@@ -0,0 +1,112 @@
+//============================================================================
+// Super-Simple Tasker (SST/C++)
+//
+// Copyright (C) 2006-2023 Quantum Leaps, <state-machine.com>.
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//============================================================================
+#ifndef SST_PIPE_HPP_
+#define SST_PIPE_HPP_
+
+#include "sst.hpp" // Super-Simple Tasker (SST/C++)
+
+namespace SST {
+
+// SST Pipeline facilities ---------------------------------------------------
+//! SST pipeline link with credit-based backpressure
+//!
+//! @details
+//! The link connects a producer (a task or an ISR) to the downstream
+//! consumer task of a pipeline. The link starts with a number of credits,
+//! which is the part of the consumer queue reserved for this link. Every
+//! event delivered to the consumer takes one credit and every done()
+//! called by the consumer after processing the event returns it, so the
+//! consumer queue can never overflow.
+//!
+//! When no credit is available, send() keeps the event in the link
+//! (in the order of sending) and returns HELD. The held event is
+//! delivered as soon as the consumer returns a credit and then the
+//! producer receives the credit event. A pipeline stage returns the credit
+//! of its own input only after its output was delivered, so the
+//! backpressure propagates upstream to the source. When the link has no
+//! room to hold the event (an ISR source typically has none), send()
+//! drops and recycles the event and returns DROPPED, so the source can
+//! throttle itself. No credit event follows for the SENT and DROPPED
+//! events. With SST_EVT_POOL, the link keeps a reference to a held
+//! buffer event until its delivery, so a stage can forward its input
+//! buffer event in place.
+//!
+//! Every held event corresponds to an input that the stage has not
+//! released yet. Therefore, the queue of a stage needs to hold only the
+//! credits of its inbound links and the held-event buffer of its outbound
+//! link needs the same length.
+//!
+//! @par Example
+//! @code
+//! void Filter::dispatch(SST::Evt const * const e) {
+//!     if (e->sig == CREDIT_SIG) { // held output delivered downstream?
+//!         m_in->done(); // release the corresponding input
+//!     }
+//!     else if (m_out->send(process(e)) != SST::PipeLink::HELD) {
+//!         m_in->done(); // release the input (output sent or dropped)
+//!     }
+//! }
+//! @endcode
+class PipeLink {
+public:
+    //! the outcome of send()
+    enum Result : std::uint8_t {
+        SENT,    //!< delivered to the consumer
+        HELD,    //!< held in the link (the credit event follows delivery)
+        DROPPED  //!< dropped (and recycled) for lack of room in the link
+    };
+
+    PipeLink(Task * const producer, Task * const consumer,
+             QCtr const credits, Evt const * const creditEvt,
+             Evt const ** const heldBuf = nullptr, QCtr const heldLen = 0U);
+
+    // producer side
+    Result send(Evt const * const e) noexcept;
+
+    // consumer side
+    void done(void) noexcept;
+
+    QCtr getCredits(void) const noexcept { return m_credits; }
+    QCtr getNHeld(void) const noexcept { return m_nHeld; }
+    std::uint32_t getNDropped(void) const noexcept { return m_nDropped; }
+
+private:
+    Task *m_producer;      //!< the producer (nullptr for an ISR)
+    Task *m_consumer;      //!< the downstream consumer task
+    Evt const *m_creditEvt; //!< event posted when a held event is delivered
+    Evt const **m_heldBuf; //!< ring buffer of the held events
+    QCtr m_heldLen;        //!< length of the held-event ring buffer
+    QCtr m_heldHead;       //!< index for inserting held events
+    QCtr m_heldTail;       //!< index for removing held events
+    QCtr m_nHeld;          //!< # events held in the link
+    QCtr m_credits;        //!< # events the consumer can still accept
+    QCtr m_maxCredits;     //!< initial # credits
+    std::uint32_t m_nDropped; //!< # events dropped by send()
+};
+
+} // namespace SST
+
+#endif // SST_PIPE_HPP_
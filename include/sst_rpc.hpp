@@ -0,0 +1,114 @@
+//============================================================================
+// Super-Simple Tasker (SST/C++)
+//
+// Copyright (C) 2006-2023 Quantum Leaps, <state-machine.com>.
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//============================================================================
+#ifndef SST_RPC_HPP_
+#define SST_RPC_HPP_
+
+#include "sst.hpp" // Super-Simple Tasker (SST/C++)
+
+namespace SST {
+
+// SST Request/Response facilities -------------------------------------------
+struct RpcEvt;
+
+//! SST timeout event of a request (internal use only)
+struct RpcTmoEvt : public Evt {
+    RpcEvt *call; //!< the request of this timeout event
+};
+
+//! SST request event with the reply-to routing
+//!
+//! @details
+//! The application requests derive from RpcEvt and add their request and
+//! response parameters. The same event travels from the client to the
+//! server as the request and back to the client as the response, so
+//! the server needs no memory of its own for the responses.
+struct RpcEvt : public Evt {
+    Task *replyTo;        //!< the originator of the request (reply-to)
+    std::uint16_t corrId; //!< correlation ID of the request
+    std::uint8_t status;  //!< status of the response (application-specific)
+    std::uint8_t flags_;  //!< (internal use only)
+    RpcEvt *next_;        //!< (internal use only)
+    TimeoutPool::Handle tmo_; //!< (internal use only)
+    RpcTmoEvt tmoEvt_;    //!< (internal use only)
+};
+
+//! SST pool of the requests of a client task
+//!
+//! @details
+//! The client task allocates a request with alloc(), fills in the
+//! parameters and sends it to the server with call(), which also arms
+//! the timeout of the request in the provided SST::TimeoutPool. The server
+//! answers every request with reply(), which posts the request event
+//! (now with the response signal) directly back to the originator.
+//!
+//! In its dispatch(), the client passes the response to complete() and
+//! the timeout event to expire(). Either of them returns the request
+//! only for the first outcome, so a late response after the timeout (or
+//! a timeout racing with the response) is reported as nullptr. A timed
+//! out request returns to the pool only after the late response arrives,
+//! because the server might still be working on it. All operations are
+//! O(1) and allocation-free.
+//!
+//! @note
+//! All operations except reply() must be called from the client task.
+//! The server must reply to every request (possibly with an error status).
+class RpcPool {
+public:
+    void init(void * const sto, std::uint32_t const stoSize,
+              std::uint32_t const evtSize,
+              Task * const owner, Signal const tmoSig,
+              TimeoutPool * const tmoPool);
+
+    // client side (the owner task)
+    RpcEvt *alloc(Signal const sig) noexcept;
+    bool call(Task * const server, RpcEvt * const req,
+              TCtr const timeout) noexcept;
+    RpcEvt const *complete(Evt const * const e) noexcept;
+    RpcEvt const *expire(Evt const * const e) noexcept;
+    void release(RpcEvt const * const rsp) noexcept;
+
+    // server side
+    static void reply(RpcEvt const * const req, Signal const sig,
+                      std::uint8_t const status = 0U) noexcept;
+
+    std::uint16_t getNFree(void) const noexcept { return m_nFree; }
+    std::uint16_t getNTimeouts(void) const noexcept { return m_nTimeouts; }
+
+private:
+    RpcEvt *m_free;        //!< head of the list of free requests
+    Task *m_owner;         //!< the client task
+    TimeoutPool *m_tmoPool; //!< the pool for the request timeouts
+    Signal m_tmoSig;       //!< signal of the timeout events
+    std::uint16_t m_nextId; //!< next correlation ID
+    std::uint16_t m_nFree; //!< # free requests
+    std::uint16_t m_nTimeouts; //!< # requests timed out
+
+    void free_(RpcEvt * const req) noexcept;
+};
+
+} // namespace SST
+
+#endif // SST_RPC_HPP_
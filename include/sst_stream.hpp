@@ -0,0 +1,91 @@
+//============================================================================
+// Super-Simple Tasker (SST/C++)
+//
+// Copyright (C) 2006-2023 Quantum Leaps, <state-machine.com>.
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//============================================================================
+#ifndef SST_STREAM_HPP_
+#define SST_STREAM_HPP_
+
+#include "sst.hpp" // Super-Simple Tasker (SST/C++)
+
+namespace SST {
+
+// SST Stream Buffer facilities ----------------------------------------------
+//! SST stream buffer (byte pipe from a single producer to a single task)
+//!
+//! @details
+//! The bytes are passed through a lock-free single-producer/single-consumer
+//! ring buffer. The producer (typically an ISR) writes the bytes without
+//! any critical section and the consumer task is notified by posting the
+//! provided event only when the number of buffered bytes reaches the
+//! threshold, when flush() is called (e.g., from the UART idle-line ISR),
+//! or when no byte was written for the idle timeout. The event is posted
+//! at most once until the consumer empties the buffer, so the consumer
+//! must keep calling read() until it returns fewer bytes than requested.
+//!
+//! @note
+//! The idle timeout is measured with a periodic SST::TimeCb, so it is
+//! detected between one and two idle periods after the last byte.
+class StreamBuf {
+public:
+    StreamBuf(std::uint8_t * const sto, std::uint16_t const len,
+              Task * const task, Evt const * const e,
+              TickDomain const domain = 0U);
+    void setThreshold(std::uint16_t const threshold) noexcept;
+    void setIdleTimeout(TCtr const ticks);
+
+    // producer side (single producer)
+    std::uint16_t write(std::uint8_t const * const data,
+                        std::uint16_t const n) noexcept;
+    bool put(std::uint8_t const b) noexcept;
+    void flush(void) noexcept;
+
+    // consumer side (the task)
+    std::uint16_t read(std::uint8_t * const buf,
+                       std::uint16_t const n) noexcept;
+
+    std::uint16_t getNUsed(void) const noexcept {
+        return static_cast<std::uint16_t>(m_wr - m_rd);
+    }
+    std::uint32_t getNLost(void) const noexcept { return m_nLost; }
+
+private:
+    std::uint8_t *m_sto;        //!< ring buffer storage
+    Task *m_task;               //!< the consumer task
+    Evt const *m_evt;           //!< event posted to the consumer
+    TimeCb m_idleCb;            //!< periodic idle-line check
+    std::uint16_t m_mask;       //!< ring buffer length - 1
+    std::uint16_t m_threshold;  //!< # bytes to notify the consumer
+    std::uint16_t volatile m_wr; //!< free-running write counter (producer)
+    std::uint16_t volatile m_rd; //!< free-running read counter (consumer)
+    std::uint16_t m_idleWr;     //!< m_wr at the previous idle check
+    bool volatile m_pended;     //!< consumer notified and not done yet
+    std::uint32_t m_nLost;      //!< # bytes lost due to a full buffer
+
+    void notify_(void) noexcept;
+    static void idle_(void *par);
+};
+
+} // namespace SST
+
+#endif // SST_STREAM_HPP_
@@ -0,0 +1,80 @@
+//============================================================================
+// Super-Simple Tasker (SST/C++)
+//
+// Copyright (C) 2006-2023 Quantum Leaps, <state-machine.com>.
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//============================================================================
+#ifndef SST_WORK_HPP_
+#define SST_WORK_HPP_
+
+#include "sst.hpp" // Super-Simple Tasker (SST/C++)
+
+namespace SST {
+
+// SST Work Queue facilities -------------------------------------------------
+//! SST task running lightweight work items (function plus argument)
+//!
+//! @details
+//! The work items submitted to the WorkQueue run to completion, one after
+//! another in the submission order, at the SST priority of the WorkQueue.
+//! Rarely used background jobs thus share one task (with its IRQ) instead
+//! of each needing a SST::Task subclass with its own queue and dispatch().
+//! Like TickTask, the WorkQueue is activated only when the first item
+//! arrives, so all pending items run in a single activation.
+//!
+//! Like any other SST task, the WorkQueue needs to be assigned an IRQ by
+//! the port-specific means before it is started.
+class WorkQueue : public Task {
+public:
+    //! the work item function type
+    using WorkFn = void (*)(void *arg);
+
+    //! the work item
+    struct Item {
+        WorkFn fn;  //!< the function to run
+        void *arg;  //!< the argument for the function
+    };
+
+    WorkQueue(Item * const sto, QCtr const len);
+    void start(TaskPrio prio);
+    bool submit(WorkFn const fn, void * const arg) noexcept;
+
+    QCtr getNItems(void) const noexcept { return m_nItems; }
+    QCtr getNMax(void) const noexcept { return m_nMax; }
+
+    void init(Evt const * const ie) override;
+    void dispatch(Evt const * const e) override;
+
+private:
+    Evt const *m_qSto[1]; //!< queue storage for the activation requests
+    Item *m_sto;  //!< ring buffer of the work items
+    QCtr m_len;   //!< length of the ring buffer
+    QCtr m_itemHead;  //!< index for inserting work items
+    QCtr m_itemTail;  //!< index for removing work items
+    QCtr m_nItems; //!< # work items waiting to run
+    QCtr m_nMax;  //!< maximum # work items waiting so far
+    bool m_posted; //!< activation event posted but not dispatched yet?
+};
+
+} // namespace SST
+
+#endif // SST_WORK_HPP_
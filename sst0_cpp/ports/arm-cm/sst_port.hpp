@@ -37,9 +37,66 @@
 #define SST_PORT_INT_ENABLE()  __asm volatile ("cpsie i")
 
 // SST-PORT critical section
-#define SST_PORT_CRIT_STAT
-#define SST_PORT_CRIT_ENTRY() SST_PORT_INT_DISABLE()
-#define SST_PORT_CRIT_EXIT()  SST_PORT_INT_ENABLE()
+// NOTE: the critical section saves and restores the interrupt masking
+// state, so it can nest and can be used with interrupts already disabled.
+//
+#if (__ARM_ARCH != 6) && defined SST_PORT_BASEPRI // ARMv7-M+ with BASEPRI?
+// The critical section raises BASEPRI to SST_PORT_BASEPRI (the priority
+// written to the BASEPRI register, e.g., 0x20 for the NVIC priority level 1
+// with 3 implemented priority bits). The interrupts with the numerically
+// lower (more urgent) priorities are never masked by SST ("zero-latency"),
+// but they must not call any SST services. All SST tasks and the ISRs
+// calling SST services must be at priorities SST_PORT_BASEPRI or lower.
+// The BASEPRI write is surrounded by "cpsid i"/PRIMASK restore to work
+// around the Cortex-M7 r0p1 erratum 837070 (interrupt taken after the
+// write to BASEPRI). PRIMASK is restored rather than cleared, so the
+// critical section does not enable interrupts disabled by the caller.
+//
+#define SST_PORT_CRIT_STAT    std::uint32_t crit_stat_;
+#define SST_PORT_CRIT_ENTRY() do { \
+    std::uint32_t primask_; \
+    __asm volatile ("mrs %0,BASEPRI" : "=r" (crit_stat_) :: ); \
+    __asm volatile ("mrs %0,PRIMASK" : "=r" (primask_) :: ); \
+    __asm volatile ("cpsid i\n msr BASEPRI_MAX,%0\n msr PRIMASK,%1" \
+                    :: "r" (SST_PORT_BASEPRI), "r" (primask_) : "memory"); \
+} while (false)
+#define SST_PORT_CRIT_EXIT() \
+    __asm volatile ("msr BASEPRI,%0" :: "r" (crit_stat_) : "memory")
+#else // PRIMASK (all interrupts)
+#define SST_PORT_CRIT_STAT    std::uint32_t crit_stat_;
+#define SST_PORT_CRIT_ENTRY() do { \
+    __asm volatile ("mrs %0,PRIMASK" : "=r" (crit_stat_) :: ); \
+    __asm volatile ("cpsid i" ::: "memory"); \
+} while (false)
+#define SST_PORT_CRIT_EXIT() \
+    __asm volatile ("msr PRIMASK,%0" :: "r" (crit_stat_) : "memory")
+#endif
+
+// SST-PORT ID of the current context (the active exception number in IPSR:
+// 0 for main(), 15 for SysTick, 16+ for the IRQs, including the SST tasks)
+#define SST_PORT_CONTEXT_ID() (SST::portIpsr_())
+
+// SST-PORT current stack pointer (for SST::stackPaint())
+#define SST_PORT_STACK_PTR()  (SST::portSp_())
+
+#if (__ARM_ARCH != 6) // ARMv7-M+?
+// SST-PORT timestamp from the DWT cycle counter (enabled in SST::init()
+// when SST_EVT_DEADLINE, SST_TASK_BUDGET or SST_LATENCY is defined)
+#define SST_PORT_TIMESTAMP() \
+    (*reinterpret_cast<std::uint32_t volatile *>(0xE0001004U))
+
+#if defined SST_EVT_DEADLINE || defined SST_TASK_BUDGET \
+    || defined SST_LATENCY
+// SST-PORT initialization called from SST::init(): enable the DWT cycle
+// counter (TRCENA in DEMCR, unlock the DWT for Cortex-M7, CYCCNTENA)
+#define SST_PORT_INIT() do { \
+    *reinterpret_cast<std::uint32_t volatile *>(0xE000EDFCU) |= (1U << 24U); \
+    *reinterpret_cast<std::uint32_t volatile *>(0xE0001FB0U) = 0xC5ACCE55U; \
+    *reinterpret_cast<std::uint32_t volatile *>(0xE0001004U) = 0U; \
+    *reinterpret_cast<std::uint32_t volatile *>(0xE0001000U) |= 1U; \
+} while (false)
+#endif
+#endif
 
 namespace SST {
     using ReadySet = std::uint32_t;
@@ -47,6 +104,21 @@ namespace SST {
     //! SST lock key
     using LockKey = std::uint32_t;
 
+    inline std::uint16_t portIpsr_(void) noexcept {
+        std::uint32_t ipsr; // initialized in the following asm() instruction
+        __asm volatile ("mrs %0,IPSR" : "=r" (ipsr) :: );
+        return static_cast<std::uint16_t>(ipsr);
+    }
+    inline std::uint32_t *portSp_(void) noexcept {
+        std::uint32_t *sp; // initialized in the following asm() instruction
+        __asm volatile ("mov %0,sp" : "=r" (sp) :: );
+        return sp;
+    }
+
+    // high-watermark check of the main stack shared by all tasks and ISRs
+    void stackPaint(void * const stackBottom, void * const stackTop) noexcept;
+    std::uint32_t stackUsed(void) noexcept;
+
     // special idle callback to handle the "idle condition" in SST0
     void onIdleCond(void);
 }
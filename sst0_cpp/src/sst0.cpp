@@ -36,12 +36,55 @@ static SST::ReadySet task_readySet;
 // array of all SST task pointers in the system
 static SST::Task *task_registry[SST_PORT_MAX_TASK + 1U];
 
+#ifdef SST_EVT_DEADLINE
+// deadline monitoring (see SST::setDeadlineMonitor())
+static std::uint16_t *deadline_sigCtrs; // deadline misses per signal
+static SST::Signal deadline_nSig;       // # signals in deadline_sigCtrs
+static SST::DeadlineMissHandler deadline_handler;
+#endif
+
+#ifdef SST_TASK_BUDGET
+// innermost task activation in progress (see SST::Task::checkBudget())
+static SST::Task *budget_running;
+#endif
+
+#ifdef SST_LATENCY
+// latency histograms (see SST::setLatencyHist())
+static SST::LatencyHist *latency_hist;
+static std::uint16_t latency_len;
+static std::uint32_t latency_nLost; // samples without a free histogram
+
+// does the histogram belong to the producer, task and signal?
+static bool latency_match(SST::LatencyHist const * const h,
+                          SST::Task const * const task,
+                          std::uint16_t const producer,
+                          SST::Signal const sig)
+{
+    return (h->task == task) && (h->sig == sig) && (h->producer == producer);
+}
+#endif
+
+#ifdef SST_EVT_POOL
+// registered block pools (see SST::BlockPool::init())
+static SST::BlockPool *blockPool_head;
+#endif
+
+#ifdef SST_PORT_STACK_PTR
+// main stack painted by SST::stackPaint()
+static std::uint32_t *stack_bottom;
+static std::uint32_t *stack_top;
+constexpr std::uint32_t STACK_PAINT = 0xDEADBEEFU; // pattern of unused stack
+#endif
+
 } // unnamed namespace
 
 namespace SST {
 
 // SST kernel facilities -----------------------------------------------------
 void init(void) {
+#ifdef SST_PORT_INIT
+    SST_PORT_INIT(); // port-specific initialization
+#endif
 }
 //............................................................................
 int Task::run(void) { // static
@@ -63,6 +106,15 @@ int Task::run(void) { // static
             // only from this task
             //
             Evt const *e = task->m_qBuf[task->m_tail];
+#ifdef SST_EVT_DEADLINE
+            Timestamp const dl = (task->m_dlBuf != nullptr)
+                                 ? task->m_dlBuf[task->m_tail] : 0U;
+#endif
+#ifdef SST_LATENCY
+            LatencyStamp const stamp = (task->m_latBuf != nullptr)
+                                       ? task->m_latBuf[task->m_tail]
+                                       : LatencyStamp();
+#endif
             if (task->m_tail == 0U) { /* need to wrap the tail? */
                 task->m_tail = task->m_end; /* wrap around */
             }
@@ -73,11 +125,40 @@ int Task::run(void) { // static
             if ((--task->m_nUsed) == 0U) { /* no more events in the queue? */
                 task_readySet &= ~(1U << (p - 1U));
             }
+#ifdef SST_SIG_COALESCE
+            task->unpend_(e); // the signal no longer in the queue
+#endif
+#ifdef SST_QUEUE_WATERMARK
+            bool const resume = task->drained_();
+#endif
             SST_PORT_INT_ENABLE();
+#ifdef SST_QUEUE_WATERMARK
+            if (resume) { // drained to the low-watermark?
+                task->m_wmProducer->post(task->m_resumeEvt);
+            }
+#endif
 
+#ifdef SST_LATENCY
+            if (task->m_latBuf != nullptr) {
+                task->recordLatency_(e, stamp);
+            }
+#endif
+#ifdef SST_TASK_BUDGET
+            task->budgetEnter_();
+#endif
             // dispatch the received event to this task
             task->dispatch(e); // virtual call
-            // TBD: implement event recycling
+#ifdef SST_TASK_BUDGET
+            task->budgetExit_();
+#endif
+#ifdef SST_EVT_DEADLINE
+            if (dl != 0U) { // deadline to check?
+                task->checkDeadline_(e, dl);
+            }
+#endif
+#ifdef SST_EVT_POOL
+            gc(e); // recycle the event
+#endif
         }
         else { // no SST tasks are ready to run --> idle
 
@@ -101,6 +182,53 @@ int Task::run(void) { // static
 }
 
 // SST Task facilities -------------------------------------------------------
+Task::Task(void) noexcept {
+    // NOTE: the optional facilities are zeroed here rather than in start(),
+    // because their setters can be called before start(). A Task with
+    // automatic or dynamic storage thus starts with all of them disabled.
+    m_qBuf  = nullptr;
+    m_end   = 0U;
+    m_head  = 0U;
+    m_tail  = 0U;
+    m_nUsed = 0U;
+#ifdef SST_EVT_DEADLINE
+    m_dlBuf   = nullptr;
+    m_nMissed = 0U;
+#endif
+#ifdef SST_TASK_BUDGET
+    m_budget     = 0U;
+    m_start      = 0U;
+    m_preempt    = 0U;
+    m_preempted  = nullptr;
+    m_supervisor = nullptr;
+    m_overrunEvt = nullptr;
+    m_nOverruns  = 0U;
+    m_policy     = BUDGET_COUNT;
+    m_overrun    = false;
+#endif
+#ifdef SST_LATENCY
+    m_latBuf = nullptr;
+#endif
+#ifdef SST_QUEUE_WATERMARK
+    m_wmProducer    = nullptr;
+    m_resumeEvt     = nullptr;
+    m_lowWatermark  = 0U;
+    m_highWatermark = 0U;
+    m_throttled     = false;
+#endif
+#ifdef SST_SIG_FILTER
+    m_sigMask   = nullptr;
+    m_nSig      = 0U;
+    m_nFiltered = 0U;
+#endif
+#ifdef SST_SIG_COALESCE
+    m_coalMask   = nullptr;
+    m_coalPend   = nullptr;
+    m_coalNSig   = 0U;
+    m_nCoalesced = 0U;
+#endif
+}
+//............................................................................
 void Task::start(
     TaskPrio prio,
     Evt const **qBuf, QCtr qLen,
@@ -123,21 +251,60 @@ void Task::start(
     m_head  = 0U;
     m_tail  = 0U;
     m_nUsed = 0U;
+#ifdef SST_EVT_DEADLINE
+    // NOTE: m_dlBuf is not reset, because setDeadlineBuf() needs to be
+    // called before start()
+    m_nMissed = 0U;
+#endif
+#ifdef SST_TASK_BUDGET
+    // NOTE: the budget is not reset, so setBudget() can be called
+    // before start()
+    m_nOverruns = 0U;
+#endif
 
     task_registry[prio] = this;
 
     // initialize this task with the initialization event
     init(ie); // virtual call
-    // TBD: implement event recycling
+#ifdef SST_EVT_POOL
+    gc(ie); // recycle the initialization event
+#endif
 }
 //............................................................................
 void Task::post(Evt const * const e) noexcept {
+#ifdef SST_SIG_FILTER
+    if (filter_(e)) { // signal not accepted by this task?
+        return; // event dropped without using the queue
+    }
+#endif
+#ifdef SST_SIG_COALESCE
+    if (coalesce_(e)) { // the same signal already in the queue?
+        return; // duplicate event suppressed
+    }
+#endif
     //! @pre the queue must be sized adequately and cannot overflow
     DBC_REQUIRE(300, m_nUsed <= m_end);
 
+#ifdef SST_LATENCY
+    Timestamp const now = SST_PORT_TIMESTAMP(); // before the crit. section
+#endif
     SST_PORT_CRIT_STAT
     SST_PORT_CRIT_ENTRY();
     m_qBuf[m_head] = e; // insert event into the queue
+#ifdef SST_EVT_POOL
+    BlockPool::ref_(e); // one more reference to a buffer event
+#endif
+#ifdef SST_LATENCY
+    if (m_latBuf != nullptr) {
+        m_latBuf[m_head].ts       = now;
+        m_latBuf[m_head].producer = SST_PORT_CONTEXT_ID();
+    }
+#endif
+#ifdef SST_EVT_DEADLINE
+    if (m_dlBuf != nullptr) {
+        m_dlBuf[m_head] = 0U; // no deadline
+    }
+#endif
     // need to wrap the head?
     if (m_head == 0U) {
         m_head = m_end; // wrap around
@@ -146,61 +313,1236 @@ void Task::post(Evt const * const e) noexcept {
         --m_head;
     }
     ++m_nUsed;
+#ifdef SST_QUEUE_WATERMARK
+    if ((m_wmProducer != nullptr) && (m_nUsed >= m_highWatermark)) {
+        m_throttled = true; // resume the producer when drained
+    }
+#endif
     task_readySet |= (1U << (m_prio - 1U));
     SST_PORT_CRIT_EXIT();
 }
+//............................................................................
+void Task::postLIFO(Evt const * const e) noexcept {
+    //! @pre the queue must be sized adequately and cannot overflow
+    DBC_REQUIRE(400, m_nUsed <= m_end);
 
-//----------------------------------------------------------------------------
-static TimeEvt *timeEvt_head = nullptr;
+    // NOTE: this operation modifies m_tail and therefore can be called
+    // only from this task (e.g., to recall deferred events)
+#ifdef SST_LATENCY
+    Timestamp const now = SST_PORT_TIMESTAMP(); // before the crit. section
+#endif
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    // need to wrap the tail?
+    if (m_tail == m_end) {
+        m_tail = 0U; // wrap around
+    }
+    else {
+        ++m_tail;
+    }
+    m_qBuf[m_tail] = e; // insert event at the front of the queue
+#ifdef SST_SIG_COALESCE
+    // NOTE: the event bypasses coalesce_(), but unpend_() still clears
+    // the pending bit when the event is removed from the queue
+    if ((m_coalMask != nullptr) && (e->sig < m_coalNSig)) {
+        std::uint32_t const bit = (1U << (e->sig & 0x1FU));
+        if ((m_coalMask[e->sig >> 5U] & bit) != 0U) {
+            m_coalPend[e->sig >> 5U] |= bit; // the signal is queued
+        }
+    }
+#endif
+#ifdef SST_EVT_POOL
+    BlockPool::ref_(e); // one more reference to a buffer event
+#endif
+#ifdef SST_LATENCY
+    if (m_latBuf != nullptr) {
+        m_latBuf[m_tail].ts       = now;
+        m_latBuf[m_tail].producer = SST_PORT_CONTEXT_ID();
+    }
+#endif
+#ifdef SST_EVT_DEADLINE
+    if (m_dlBuf != nullptr) {
+        m_dlBuf[m_tail] = 0U; // no deadline
+    }
+#endif
+    ++m_nUsed;
+#ifdef SST_QUEUE_WATERMARK
+    if ((m_wmProducer != nullptr) && (m_nUsed >= m_highWatermark)) {
+        m_throttled = true; // resume the producer when drained
+    }
+#endif
+    task_readySet |= (1U << (m_prio - 1U));
+    SST_PORT_CRIT_EXIT();
+}
 
+
+#ifdef SST_EVT_DEADLINE
 //............................................................................
-TimeEvt::TimeEvt(Signal sig, Task *task) {
-    this->sig  = sig;
-    m_task     = task;
-    m_ctr      = 0U;
-    m_interval = 0U;
+void Task::setDeadlineBuf(Timestamp * const dlBuf) noexcept {
+    //! @pre the deadline buffer must be provided and must have the same
+    //! length as the event queue, which is not started yet
+    DBC_REQUIRE(1700, dlBuf != nullptr);
 
-    // insert this time event into the linked-list
-    m_next = timeEvt_head;
-    timeEvt_head = this;
+    m_dlBuf = dlBuf;
 }
 //............................................................................
-void TimeEvt::arm(TCtr ctr, TCtr interval) {
+void Task::post(Evt const * const e, Timestamp const budget) noexcept {
+#ifdef SST_SIG_FILTER
+    if (filter_(e)) { // signal not accepted by this task?
+        return; // event dropped without using the queue
+    }
+#endif
+#ifdef SST_SIG_COALESCE
+    if (coalesce_(e)) { // the same signal already in the queue?
+        return; // duplicate event suppressed
+    }
+#endif
+    //! @pre
+    //! - the deadline buffer must be provided
+    //! - the queue must be sized adequately and cannot overflow
+    DBC_REQUIRE(1800, (m_dlBuf != nullptr) && (m_nUsed <= m_end));
+
+    Timestamp dl = SST_PORT_TIMESTAMP() + budget;
+    if (dl == 0U) { // reserved for "no deadline"?
+        dl = 1U; // the deadline one timestamp unit later
+    }
+#ifdef SST_LATENCY
+    Timestamp const now = SST_PORT_TIMESTAMP(); // before the crit. section
+#endif
+
     SST_PORT_CRIT_STAT
     SST_PORT_CRIT_ENTRY();
-    m_ctr      = ctr;
-    m_interval = interval;
+    m_qBuf[m_head]  = e;  // insert event into the queue
+#ifdef SST_EVT_POOL
+    BlockPool::ref_(e); // one more reference to a buffer event
+#endif
+    m_dlBuf[m_head] = dl; // and its deadline
+#ifdef SST_LATENCY
+    if (m_latBuf != nullptr) {
+        m_latBuf[m_head].ts       = now;
+        m_latBuf[m_head].producer = SST_PORT_CONTEXT_ID();
+    }
+#endif
+    // need to wrap the head?
+    if (m_head == 0U) {
+        m_head = m_end; // wrap around
+    }
+    else {
+        --m_head;
+    }
+    ++m_nUsed;
+#ifdef SST_QUEUE_WATERMARK
+    if ((m_wmProducer != nullptr) && (m_nUsed >= m_highWatermark)) {
+        m_throttled = true; // resume the producer when drained
+    }
+#endif
+    task_readySet |= (1U << (m_prio - 1U));
     SST_PORT_CRIT_EXIT();
 }
 //............................................................................
-bool TimeEvt::disarm(void) {
+void Task::checkDeadline_(Evt const * const e, Timestamp const dl) noexcept {
+    // NOTE: the timestamps wrap around, so the deadline is missed when
+    // the time elapsed since the deadline is in the lower half of range
+    Timestamp const late = SST_PORT_TIMESTAMP() - dl;
+    if ((late == 0U) || (late > (~static_cast<Timestamp>(0) >> 1U))) {
+        return; // deadline met
+    }
+
+    ++m_nMissed; // NOTE: modified only from this task
+
     SST_PORT_CRIT_STAT
     SST_PORT_CRIT_ENTRY();
-    bool status = (m_ctr != 0U);
-    m_ctr       = 0U;
-    m_interval  = 0U;
+    if (e->sig < deadline_nSig) {
+        ++deadline_sigCtrs[e->sig];
+    }
+    DeadlineMissHandler const handler = deadline_handler;
     SST_PORT_CRIT_EXIT();
-    return status;
+
+    if (handler != nullptr) {
+        (*handler)(this, e, late);
+    }
 }
 //............................................................................
-void TimeEvt::tick(void) {
-    for (TimeEvt *t = timeEvt_head; t != nullptr; t = t->m_next) {
-        SST_PORT_CRIT_STAT
-        SST_PORT_CRIT_ENTRY();
-        if (t->m_ctr == 0U) { // disarmed? (most frequent case)
-            SST_PORT_CRIT_EXIT();
-        }
-        else if (t->m_ctr == 1U) { // expiring?
-            t->m_ctr = t->m_interval;
-            SST_PORT_CRIT_EXIT();
+void setDeadlineMonitor(
+    std::uint16_t * const sigCtrs, Signal const nSig,
+    DeadlineMissHandler const handler) noexcept
+{
+    //! @pre the signal counters must be provided for non-zero # signals
+    DBC_REQUIRE(1900, (nSig == 0U) || (sigCtrs != nullptr));
 
-            t->m_task->post(t);
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    deadline_sigCtrs = sigCtrs;
+    deadline_nSig    = nSig;
+    deadline_handler = handler;
+    SST_PORT_CRIT_EXIT();
+}
+#endif // SST_EVT_DEADLINE
+
+#ifdef SST_TASK_BUDGET
+//............................................................................
+void Task::setBudget(Timestamp const budget, BudgetPolicy const policy,
+                     Task * const supervisor,
+                     Evt const * const overrunEvt) noexcept
+{
+    //! @pre the supervisor and the overrun event must be provided for
+    //! the BUDGET_NOTIFY policy
+    DBC_REQUIRE(2000, (policy != BUDGET_NOTIFY)
+                      || ((supervisor != nullptr) && (overrunEvt != nullptr)));
+
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    m_budget     = budget;
+    m_policy     = policy;
+    m_supervisor = supervisor;
+    m_overrunEvt = overrunEvt;
+    SST_PORT_CRIT_EXIT();
+}
+//............................................................................
+void Task::checkBudget(void) noexcept { // static
+    // NOTE: called periodically (e.g., from the system clock tick ISR or
+    // from a compare-match ISR of a hardware timer) to detect the overrun
+    // of the running task before its activation completes
+    Timestamp const now = SST_PORT_TIMESTAMP();
+
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    Task * const task = budget_running;
+    bool over = false;
+    if ((task != nullptr) && (task->m_budget != 0U) && (!task->m_overrun)) {
+        // NOTE: the activation could start after the timestamp was taken,
+        // in which case the time used is "negative" (upper half of range)
+        Timestamp const used = now - task->m_start - task->m_preempt;
+        over = (used > task->m_budget)
+               && (used <= (~static_cast<Timestamp>(0) >> 1U));
+        task->m_overrun = over;
+    }
+    SST_PORT_CRIT_EXIT();
+
+    if (over) {
+        task->overrun_();
+    }
+}
+//............................................................................
+void Task::budgetEnter_(void) noexcept {
+    Timestamp const now = SST_PORT_TIMESTAMP();
+
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    m_preempted = budget_running; // remember the preempted task (if any)
+    budget_running = this;
+    m_start   = now;
+    m_preempt = 0U;
+    m_overrun = false;
+    SST_PORT_CRIT_EXIT();
+}
+//............................................................................
+void Task::budgetExit_(void) noexcept {
+    Timestamp const now = SST_PORT_TIMESTAMP();
+
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    Timestamp const elapsed = now - m_start;
+    bool const over = (m_budget != 0U) && (!m_overrun)
+                      && ((elapsed - m_preempt) > m_budget);
+    m_overrun = m_overrun || over;
+
+    // the whole activation of this task counts as preemption of
+    // the resumed task, so it does not count against its budget
+    budget_running = m_preempted;
+    if (m_preempted != nullptr) {
+        m_preempted->m_preempt += elapsed;
+    }
+    SST_PORT_CRIT_EXIT();
+
+    if (over) {
+        overrun_();
+    }
+}
+//............................................................................
+void Task::overrun_(void) noexcept {
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    ++m_nOverruns; // NOTE: modified from this task and from the ISRs
+    BudgetPolicy const policy = m_policy;
+    SST_PORT_CRIT_EXIT();
+
+    switch (policy) {
+        case BUDGET_NOTIFY:
+            m_supervisor->post(m_overrunEvt);
+            break;
+        case BUDGET_FAULT:
+            DBC_ERROR(2100);
+            break;
+        default: // BUDGET_COUNT
+            break;
+    }
+}
+#endif // SST_TASK_BUDGET
+
+#ifdef SST_LATENCY
+//............................................................................
+void Task::setLatencyBuf(LatencyStamp * const latBuf) noexcept {
+    //! @pre the latency buffer must be provided and must have the same
+    //! length as the event queue, which is not started yet
+    DBC_REQUIRE(2200, latBuf != nullptr);
+
+    m_latBuf = latBuf;
+}
+//............................................................................
+void Task::recordLatency_(Evt const * const e,
+                          LatencyStamp const &stamp) noexcept
+{
+    Timestamp const lat = SST_PORT_TIMESTAMP() - stamp.ts;
+
+    // logarithmic bin of the latency
+    std::uint_fast8_t bin = 0U;
+    for (Timestamp x = lat; (x > 1U) && (bin < (SST_LATENCY_NBIN - 1U));
+         x >>= 1U)
+    {
+        ++bin;
+    }
+
+    // NOTE: the histograms are shared by all tasks, but they are only
+    // allocated (in order) and never released, except by setLatencyHist().
+    // Therefore, the (linear) search for the histogram of this producer,
+    // task and signal runs outside the critical section. It stops at the
+    // matching or at the first unused histogram.
+    LatencyHist * const hist = latency_hist;
+    std::uint_fast16_t const len = latency_len;
+    std::uint_fast16_t i = 0U;
+    while ((i < len) && (hist[i].task != nullptr)
+           && !latency_match(&hist[i], this, stamp.producer, e->sig))
+    {
+        ++i;
+    }
+
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    // skip the histograms allocated by the contexts that preempted the
+    // search above (none in most cases)
+    while ((i < len) && (hist[i].task != nullptr)
+           && !latency_match(&hist[i], this, stamp.producer, e->sig))
+    {
+        ++i;
+    }
+    if (i < len) {
+        LatencyHist * const h = &hist[i];
+        if (h->task == nullptr) { // unused histogram? --> allocate it
+            h->producer = stamp.producer;
+            h->sig      = e->sig;
+            h->task     = this;
         }
-        else { // timing out
-            --t->m_ctr;
-            SST_PORT_CRIT_EXIT();
+        if ((h->nSamples == 0U) || (h->min > lat)) {
+            h->min = lat;
+        }
+        if (h->max < lat) {
+            h->max = lat;
         }
+        ++h->nSamples;
+        h->sum += lat;
+        ++h->bins[bin];
+    }
+    else { // no histogram available
+        ++latency_nLost;
+    }
+    SST_PORT_CRIT_EXIT();
+}
+//............................................................................
+void setLatencyHist(LatencyHist * const hist,
+                    std::uint16_t const len) noexcept
+{
+    //! @pre the histograms must be provided for non-zero length
+    DBC_REQUIRE(2300, (len == 0U) || (hist != nullptr));
+
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    for (std::uint_fast16_t i = 0U; i < len; ++i) {
+        hist[i] = LatencyHist(); // all counters zero, unused
+    }
+    latency_hist  = hist;
+    latency_len   = len;
+    latency_nLost = 0U;
+    SST_PORT_CRIT_EXIT();
+}
+//............................................................................
+std::uint32_t getLatencyNLost(void) noexcept {
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    std::uint32_t const nLost = latency_nLost;
+    SST_PORT_CRIT_EXIT();
+    return nLost;
+}
+#endif // SST_LATENCY
+
+#ifdef SST_QUEUE_WATERMARK
+//............................................................................
+void Task::setWatermarks(QCtr const low, QCtr const high,
+                         Task * const producer,
+                         Evt const * const resumeEvt) noexcept
+{
+    //! @pre
+    //! - the low-watermark must be below the high-watermark
+    //! - the resume event must be provided with the producer
+    //!   (the nullptr producer disables the flow control)
+    DBC_REQUIRE(2700, (low < high)
+                      && ((producer == nullptr) || (resumeEvt != nullptr)));
+
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    m_lowWatermark  = low;
+    m_highWatermark = high;
+    m_wmProducer    = producer;
+    m_resumeEvt     = resumeEvt;
+    m_throttled     = (producer != nullptr) && (m_nUsed >= high);
+    SST_PORT_CRIT_EXIT();
+}
+//............................................................................
+bool Task::drained_(void) noexcept {
+    // NOTE: called in the critical section right after removing an event
+    // from the queue. The producer is resumed only once after the queue
+    // reached the high-watermark, not after every event.
+    if (m_throttled && (m_nUsed <= m_lowWatermark)) {
+        m_throttled = false;
+        return true; // post the resume event to the producer
+    }
+    return false;
+}
+#endif // SST_QUEUE_WATERMARK
+
+#ifdef SST_SIG_FILTER
+//............................................................................
+void Task::setSigFilter(std::uint32_t * const mask,
+                        Signal const nSig) noexcept
+{
+    //! @pre the mask storage for nSig signals must be provided
+    DBC_REQUIRE(2800, (mask != nullptr) && (nSig > 0U));
+
+    // initially, all signals are accepted
+    for (Signal i = 0U; i < ((nSig + 31U) >> 5U); ++i) {
+        mask[i] = ~0U;
+    }
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    m_sigMask = mask;
+    m_nSig    = nSig;
+    SST_PORT_CRIT_EXIT();
+}
+//............................................................................
+void Task::acceptSig(Signal const sig) noexcept {
+    //! @pre the signal must be covered by the signal filter
+    DBC_REQUIRE(2900, (m_sigMask != nullptr) && (sig < m_nSig));
+
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    m_sigMask[sig >> 5U] |= (1U << (sig & 0x1FU));
+    SST_PORT_CRIT_EXIT();
+}
+//............................................................................
+void Task::ignoreSig(Signal const sig) noexcept {
+    //! @pre the signal must be covered by the signal filter
+    DBC_REQUIRE(2910, (m_sigMask != nullptr) && (sig < m_nSig));
+
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    m_sigMask[sig >> 5U] &= ~(1U << (sig & 0x1FU));
+    SST_PORT_CRIT_EXIT();
+}
+//............................................................................
+bool Task::filter_(Evt const * const e) noexcept {
+    // NOTE: the signals beyond the mask are always accepted
+    Signal const sig = e->sig;
+    if ((m_sigMask == nullptr) || (sig >= m_nSig)
+        || ((m_sigMask[sig >> 5U] & (1U << (sig & 0x1FU))) != 0U))
+    {
+        return false; // event accepted
+    }
+
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    ++m_nFiltered;
+    SST_PORT_CRIT_EXIT();
+    discard_(e);
+    return true; // event filtered out
+}
+#endif // SST_SIG_FILTER
+
+#ifdef SST_SIG_COALESCE
+//............................................................................
+void Task::setCoalesceBuf(std::uint32_t * const mask,
+                          std::uint32_t * const pend,
+                          Signal const nSig) noexcept
+{
+    //! @pre the storage of both bitmaps for nSig signals must be provided
+    DBC_REQUIRE(3000, (mask != nullptr) && (pend != nullptr) && (nSig > 0U));
+
+    // initially, no signals are coalesced
+    for (Signal i = 0U; i < ((nSig + 31U) >> 5U); ++i) {
+        mask[i] = 0U;
+        pend[i] = 0U;
+    }
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    m_coalMask = mask;
+    m_coalPend = pend;
+    m_coalNSig = nSig;
+    SST_PORT_CRIT_EXIT();
+}
+//............................................................................
+void Task::coalesceSig(Signal const sig) noexcept {
+    //! @pre the signal must be covered by the bitmaps
+    DBC_REQUIRE(3100, (m_coalMask != nullptr) && (sig < m_coalNSig));
+
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    m_coalMask[sig >> 5U] |= (1U << (sig & 0x1FU));
+    SST_PORT_CRIT_EXIT();
+}
+//............................................................................
+bool Task::coalesce_(Evt const * const e) noexcept {
+    Signal const sig = e->sig;
+    if ((m_coalMask == nullptr) || (sig >= m_coalNSig)) {
+        return false; // signal not coalesced
+    }
+    std::uint32_t const bit = (1U << (sig & 0x1FU));
+
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    bool dup = false;
+    if ((m_coalMask[sig >> 5U] & bit) != 0U) { // "at most one" signal?
+        if ((m_coalPend[sig >> 5U] & bit) != 0U) { // already queued?
+            ++m_nCoalesced;
+            dup = true;
+        }
+        else {
+            m_coalPend[sig >> 5U] |= bit; // the event is going to be queued
+        }
+    }
+    SST_PORT_CRIT_EXIT();
+
+    if (dup) {
+        discard_(e);
+    }
+    return dup;
+}
+//............................................................................
+void Task::unpend_(Evt const * const e) noexcept {
+    // NOTE: called in the critical section right after removing an event
+    // from the queue, so the signal posted during the dispatch is queued
+    Signal const sig = e->sig;
+    if ((m_coalMask != nullptr) && (sig < m_coalNSig)) {
+        m_coalPend[sig >> 5U] &= ~(1U << (sig & 0x1FU));
+    }
+}
+#endif // SST_SIG_COALESCE
+
+#if (defined SST_SIG_FILTER) || (defined SST_SIG_COALESCE)
+//............................................................................
+void Task::discard_(Evt const * const e) noexcept {
+#ifdef SST_EVT_POOL
+    // NOTE: the reference taken and released right away recycles
+    // a buffer event that is not held by any other task
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    BlockPool::ref_(e);
+    SST_PORT_CRIT_EXIT();
+    gc(e);
+#else
+    static_cast<void>(e); // unused parameter
+#endif
+}
+#endif
+
+#ifdef SST_EVT_POOL
+// SST Event Pool facilities -------------------------------------------------
+void BlockPool::init(void * const sto, std::uint32_t const stoSize,
+                     std::uint32_t const blockSize)
+{
+    //! @pre
+    //! - the storage must be provided and aligned for pointers
+    //! - the block must be larger than the BufEvt descriptor
+    DBC_REQUIRE(2400,
+        (sto != nullptr)
+        && ((reinterpret_cast<std::uintptr_t>(sto) % sizeof(void *)) == 0U)
+        && (blockSize > sizeof(BufEvt)));
+
+    // round up the block size, so that all blocks are aligned for pointers
+    std::uint32_t const size = static_cast<std::uint32_t>(
+        (blockSize + sizeof(void *) - 1U) & ~(sizeof(void *) - 1U));
+    std::uint32_t const n = stoSize / size;
+
+    //! @pre the storage must hold at least one and at most 0xFFFF blocks
+    DBC_REQUIRE(2410, (0U < n) && (n <= 0xFFFFU));
+
+    m_start     = static_cast<std::uint8_t *>(sto);
+    m_end       = m_start + (n * size);
+    m_blockSize = size;
+
+    // link all blocks into the free list, the first block at the head
+    m_free = nullptr;
+    for (std::uint32_t i = n; i > 0U; --i) {
+        void ** const b = reinterpret_cast<void **>(m_start + ((i - 1U) * size));
+        *b = m_free;
+        m_free = b;
+    }
+    m_nTot  = static_cast<std::uint16_t>(n);
+    m_nFree = m_nTot;
+    m_nMin  = m_nTot;
+
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    m_next = blockPool_head; // register the pool for the event recycling
+    blockPool_head = this;
+    SST_PORT_CRIT_EXIT();
+}
+//............................................................................
+BufEvt *BlockPool::alloc(Signal const sig) noexcept {
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    void ** const b = static_cast<void **>(m_free);
+    if (b != nullptr) { // any free blocks?
+        m_free = *b;
+        --m_nFree;
+        if (m_nMin > m_nFree) {
+            m_nMin = m_nFree; // remember the low-watermark
+        }
+    }
+    SST_PORT_CRIT_EXIT();
+
+    if (b == nullptr) { // pool empty?
+        return nullptr;
+    }
+    // NOTE: the block is now owned exclusively by the caller
+    BufEvt * const e = reinterpret_cast<BufEvt *>(b);
+    e->sig       = sig;
+    e->refCtr_   = 0U;
+    e->reserved_ = 0U;
+    e->len       = 0U;
+    return e;
+}
+//............................................................................
+BlockPool *BlockPool::find_(Evt const * const e) noexcept { // static
+    // NOTE: must be called inside a critical section
+    std::uintptr_t const p = reinterpret_cast<std::uintptr_t>(e);
+    for (BlockPool *pool = blockPool_head; pool != nullptr;
+         pool = pool->m_next)
+    {
+        if ((reinterpret_cast<std::uintptr_t>(pool->m_start) <= p)
+            && (p < reinterpret_cast<std::uintptr_t>(pool->m_end)))
+        {
+            return pool;
+        }
+    }
+    return nullptr; // not a buffer event
+}
+//............................................................................
+void BlockPool::ref_(Evt const * const e) noexcept { // static
+    // NOTE: must be called inside a critical section
+    if (find_(e) != nullptr) { // buffer event?
+        BufEvt * const be = const_cast<BufEvt *>(
+                                static_cast<BufEvt const *>(e));
+        //! @pre the reference counter must not overflow
+        DBC_REQUIRE(2500, be->refCtr_ < 0xFFU);
+        ++be->refCtr_;
+    }
+}
+//............................................................................
+void gc(Evt const * const e) noexcept {
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    BlockPool * const pool = BlockPool::find_(e);
+    if (pool != nullptr) { // buffer event?
+        BufEvt * const be = const_cast<BufEvt *>(
+                                static_cast<BufEvt const *>(e));
+        if (be->refCtr_ > 1U) { // not the last reference?
+            --be->refCtr_;
+        }
+        else { // the last reference --> return the block to the pool
+            //! @pre the event must be at a block boundary
+            DBC_REQUIRE(2600,
+                ((reinterpret_cast<std::uint8_t *>(be) - pool->m_start)
+                 % pool->m_blockSize) == 0);
+
+            void ** const b = reinterpret_cast<void **>(be);
+            *b = pool->m_free;
+            pool->m_free = b;
+            ++pool->m_nFree;
+        }
+    }
+    SST_PORT_CRIT_EXIT();
+}
+#endif // SST_EVT_POOL
+
+//----------------------------------------------------------------------------
+DeferQueue::DeferQueue(Task *task, Evt const **qBuf, QCtr qLen) {
+    //! @pre
+    //! - the owner task must be provided
+    //! - the queue storage and length must be provided
+    DBC_REQUIRE(500,
+        (task != nullptr)
+        && (qBuf != nullptr) && (qLen > 0U));
+
+    m_qBuf  = qBuf;
+    m_task  = task;
+    m_end   = qLen - 1U;
+    m_head  = 0U;
+    m_tail  = 0U;
+    m_nUsed = 0U;
+}
+//............................................................................
+bool DeferQueue::defer(Evt const * const e) noexcept {
+    // NOTE: no critical section because the deferred queue is accessed
+    // only from the owner task
+    if (m_nUsed > m_end) { // no more room in the queue?
+        return false; // event not deferred
+    }
+    m_qBuf[m_head] = e; // insert event into the queue
+#ifdef SST_EVT_POOL
+    // the deferred queue holds a reference to a buffer event
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    BlockPool::ref_(e);
+    SST_PORT_CRIT_EXIT();
+#endif
+    // need to wrap the head?
+    if (m_head == 0U) {
+        m_head = m_end; // wrap around
+    }
+    else {
+        --m_head;
+    }
+    ++m_nUsed;
+    return true; // event deferred
+}
+//............................................................................
+bool DeferQueue::recall(void) noexcept {
+    if (m_nUsed == 0U) { // nothing deferred?
+        return false; // no event recalled
+    }
+    Evt const *e = m_qBuf[m_tail]; // the oldest deferred event
+    // need to wrap the tail?
+    if (m_tail == 0U) {
+        m_tail = m_end; // wrap around
+    }
+    else {
+        --m_tail;
+    }
+    --m_nUsed;
+
+    // post the recalled event to the front of the owner's queue,
+    // so that it will be dispatched ahead of other queued events
+    m_task->postLIFO(e);
+#ifdef SST_EVT_POOL
+    gc(e); // drop the reference held by the deferred queue
+#endif
+    return true; // event recalled
+}
+
+//----------------------------------------------------------------------------
+// time-event lists and # ticks so far (wraps around) for every tick domain
+// NOTE: the tick counter is incremented before TimeEvt::tick() scans the
+// list, so during the scan it is one tick ahead of the time events not
+// reached yet (see TimeEvt::lastTick_())
+static TimeEvt *timeEvt_head[SST_MAX_TICK_DOMAIN];
+static TCtr timeEvt_tickCtr[SST_MAX_TICK_DOMAIN];
+
+// lists of the time callbacks for every tick domain
+static TimeCb *timeCb_head[SST_MAX_TICK_DOMAIN];
+
+// lists of the timeout pools for every tick domain
+static TimeoutPool *timeoutPool_head[SST_MAX_TICK_DOMAIN];
+
+// time event not armed with TimeEvt::armStaggered()
+static constexpr std::uint16_t TIMEEVT_NO_STAGGER = 0xFFFFU;
+
+// down-counter to the next tick for which (tick % interval) == phase
+static TCtr timeEvt_phaseCtr(TCtr const tick, TCtr const interval,
+                             TCtr const phase)
+{
+    TCtr const rem = tick % interval;
+    return (phase > rem)
+           ? static_cast<TCtr>(phase - rem)
+           : static_cast<TCtr>(interval - rem + phase);
+}
+
+//............................................................................
+TimeEvt::TimeEvt(Signal sig, Task *task, TickDomain domain) {
+    //! @pre the tick domain must be in range
+    DBC_REQUIRE(700, domain < SST_MAX_TICK_DOMAIN);
+
+    this->sig  = sig;
+    m_task     = task;
+    m_ctr      = 0U;
+    m_interval = 0U;
+    m_domain   = domain;
+    m_stagger  = TIMEEVT_NO_STAGGER;
+    // NOTE: inserted at the head of the list, so an ongoing tick() scan
+    // does not reach this time event
+    m_tick     = static_cast<std::uint8_t>(timeEvt_tickCtr[domain]);
+
+    // insert this time event into the linked-list of its tick domain
+    m_next = timeEvt_head[domain];
+    timeEvt_head[domain] = this;
+}
+//............................................................................
+void TimeEvt::arm(TCtr ctr, TCtr interval) {
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    m_ctr      = ctr;
+    m_interval = interval;
+    m_stagger  = TIMEEVT_NO_STAGGER;
+    SST_PORT_CRIT_EXIT();
+}
+//............................................................................
+void TimeEvt::armAt(TCtr tick, TCtr interval) {
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    // NOTE: the down-counter is computed from the absolute tick and from
+    // the last tick processed for this time event in the same critical
+    // section as it is armed, so no ticks can be lost or counted twice,
+    // even when arming preempts an ongoing tick(). Subsequent periodic
+    // expirations are then exactly interval ticks apart, which anchors
+    // the time event to the kernel tick count.
+    TCtr const ctr = static_cast<TCtr>(tick - lastTick_());
+
+    //! @pre the absolute tick must not be processed yet
+    DBC_REQUIRE(600, ctr != 0U);
+
+    m_ctr      = ctr;
+    m_interval = interval;
+    m_stagger  = TIMEEVT_NO_STAGGER;
+    SST_PORT_CRIT_EXIT();
+}
+//............................................................................
+void TimeEvt::armPhase(TCtr interval, TCtr phase) {
+    //! @pre the phase must be within the (non-zero) interval
+    DBC_REQUIRE(1100, phase < interval);
+
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    // the first expiration is at the next tick for which
+    // (tick % interval) == phase, so all time events armed with the same
+    // interval and different phases never expire at the same tick.
+    // NOTE: the phase is re-aligned when the tick counter wraps around,
+    // unless the interval divides the range of the counter.
+    m_ctr      = timeEvt_phaseCtr(lastTick_(), interval, phase);
+    m_interval = interval;
+    m_stagger  = TIMEEVT_NO_STAGGER;
+    SST_PORT_CRIT_EXIT();
+}
+//............................................................................
+void TimeEvt::armStaggered(TCtr interval) {
+    //! @pre the interval must not be zero
+    DBC_REQUIRE(1200, interval != 0U);
+
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    // stagger indices of the other armed time events with the same
+    // interval in this tick domain
+    // NOTE: the list of time events is scanned only when arming
+    std::uint32_t used[256U / 32U] = { 0U };
+    for (TimeEvt const *t = timeEvt_head[m_domain]; t != nullptr;
+         t = t->m_next)
+    {
+        if ((t != this) && (t->m_stagger != TIMEEVT_NO_STAGGER)
+            && (t->m_interval == interval) && (t->m_ctr != 0U))
+        {
+            used[t->m_stagger >> 5U] |= (1U << (t->m_stagger & 0x1FU));
+        }
+    }
+    // the lowest free index, so re-arming keeps the phase of this event
+    // and the phases of disarmed events are reused
+    std::uint_fast16_t n = 0U;
+    while ((n < 256U) && ((used[n >> 5U] & (1U << (n & 0x1FU))) != 0U)) {
+        ++n;
+    }
+    if (n == 256U) { // all indices taken?
+        n = 0U; // share the phase of index 0
+    }
+
+    // the time event with index n gets the phase at the fraction
+    // rev(n)/256 of the interval, where rev() reverses the 8 bits of n
+    // (van der Corput sequence). Every new phase falls into the largest
+    // gap left by the previous ones, so time events with equal intervals
+    // are spread evenly across the ticks regardless of their number.
+    std::uint_fast16_t rev = 0U;
+    for (std::uint_fast8_t i = 0U; i < 8U; ++i) {
+        rev = (rev << 1U) | ((n >> i) & 1U);
+    }
+    // phase = interval*rev/256 computed without overflowing TCtr
+    TCtr const phase = static_cast<TCtr>(((interval >> 8U) * rev)
+                           + (((interval & 0xFFU) * rev) >> 8U));
+
+    m_ctr      = timeEvt_phaseCtr(lastTick_(), interval, phase);
+    m_interval = interval;
+    m_stagger  = static_cast<std::uint16_t>(n);
+    SST_PORT_CRIT_EXIT();
+}
+//............................................................................
+TCtr TimeEvt::lastTick_(void) const noexcept {
+    // NOTE: called in a critical section. The time event is processed
+    // for every tick, so its last tick is either the tick counter or,
+    // when the arming preempted tick() before the scan reached this time
+    // event, the tick before.
+    TCtr const ctr = timeEvt_tickCtr[m_domain];
+    return (m_tick == static_cast<std::uint8_t>(ctr))
+           ? ctr
+           : static_cast<TCtr>(ctr - 1U);
+}
+//............................................................................
+bool TimeEvt::disarm(void) {
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    bool status = (m_ctr != 0U);
+    m_ctr       = 0U;
+    m_interval  = 0U;
+    m_stagger   = TIMEEVT_NO_STAGGER;
+    SST_PORT_CRIT_EXIT();
+    return status;
+}
+//............................................................................
+void TimeEvt::tick(TickDomain const domain) {
+    //! @pre the tick domain must be in range
+    DBC_REQUIRE(800, domain < SST_MAX_TICK_DOMAIN);
+
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    TCtr const now = ++timeEvt_tickCtr[domain];
+    SST_PORT_CRIT_EXIT();
+
+    for (TimeEvt *t = timeEvt_head[domain]; t != nullptr; t = t->m_next) {
+        SST_PORT_CRIT_STAT
+        SST_PORT_CRIT_ENTRY();
+        t->m_tick = static_cast<std::uint8_t>(now); // processed for now
+        if (t->m_ctr == 0U) { // disarmed? (most frequent case)
+            SST_PORT_CRIT_EXIT();
+        }
+        else if (t->m_ctr == 1U) { // expiring?
+            t->m_ctr = t->m_interval;
+            SST_PORT_CRIT_EXIT();
+
+            t->m_task->post(t);
+        }
+        else { // timing out
+            --t->m_ctr;
+            SST_PORT_CRIT_EXIT();
+        }
+    }
+
+    for (TimeCb *t = timeCb_head[domain]; t != nullptr; t = t->m_next) {
+        SST_PORT_CRIT_STAT
+        SST_PORT_CRIT_ENTRY();
+        if (t->m_ctr == 0U) { // disarmed? (most frequent case)
+            SST_PORT_CRIT_EXIT();
+        }
+        else if (t->m_ctr == 1U) { // expiring?
+            t->m_ctr = t->m_interval;
+            SST_PORT_CRIT_EXIT();
+
+            (*t->m_cb)(t->m_par); // call the time callback
+        }
+        else { // timing out
+            --t->m_ctr;
+            SST_PORT_CRIT_EXIT();
+        }
+    }
+
+    TimeoutPool::tick(domain); // tick the timeout pools in this domain
+}
+//............................................................................
+TCtr TimeEvt::getTickCtr(TickDomain const domain) noexcept {
+    //! @pre the tick domain must be in range
+    DBC_REQUIRE(900, domain < SST_MAX_TICK_DOMAIN);
+
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    TCtr const ctr = timeEvt_tickCtr[domain];
+    SST_PORT_CRIT_EXIT();
+    return ctr;
+}
+
+//----------------------------------------------------------------------------
+TimeCb::TimeCb(Callback cb, void *par, TickDomain domain) {
+    //! @pre
+    //! - the callback function must be provided
+    //! - the tick domain must be in range
+    DBC_REQUIRE(1600,
+        (cb != nullptr) && (domain < SST_MAX_TICK_DOMAIN));
+
+    m_cb       = cb;
+    m_par      = par;
+    m_ctr      = 0U;
+    m_interval = 0U;
+
+    // insert this time callback into the linked-list of its tick domain
+    m_next = timeCb_head[domain];
+    timeCb_head[domain] = this;
+}
+//............................................................................
+void TimeCb::arm(TCtr ctr, TCtr interval) {
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    m_ctr      = ctr;
+    m_interval = interval;
+    SST_PORT_CRIT_EXIT();
+}
+//............................................................................
+bool TimeCb::disarm(void) {
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    bool status = (m_ctr != 0U);
+    m_ctr       = 0U;
+    m_interval  = 0U;
+    SST_PORT_CRIT_EXIT();
+    return status;
+}
+
+//----------------------------------------------------------------------------
+void TimeoutPool::init(Timeout * const sto, std::uint16_t const len,
+                       TickDomain const domain)
+{
+    //! @pre
+    //! - the storage must be provided
+    //! - the # timeouts must fit in the handle
+    //! - the tick domain must be in range
+    DBC_REQUIRE(1300,
+        (sto != nullptr) && (0U < len) && (len < 0xFFFFU)
+        && (domain < SST_MAX_TICK_DOMAIN));
+
+    m_sto   = sto;
+    m_armed = nullptr;
+    m_free  = nullptr;
+    m_cursor = nullptr;
+    m_len   = len;
+    m_nFree = len;
+    m_nMin  = len;
+
+    // chain all timeouts into the free list
+    for (std::uint16_t i = len; i > 0U; --i) {
+        sto[i - 1U].m_next = m_free;
+        sto[i - 1U].m_ctr  = 0U;
+        sto[i - 1U].m_gen  = 0U;
+        m_free = &sto[i - 1U];
+    }
+
+    // insert this pool into the list of its tick domain
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    m_next = timeoutPool_head[domain];
+    timeoutPool_head[domain] = this;
+    SST_PORT_CRIT_EXIT();
+}
+//............................................................................
+TimeoutPool::Handle TimeoutPool::arm(Task * const task, Evt const * const e,
+                                     TCtr const ctr) noexcept
+{
+    //! @pre the task, event and a non-zero timeout must be provided
+    DBC_REQUIRE(1400, (task != nullptr) && (e != nullptr) && (ctr != 0U));
+
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    Timeout * const t = m_free;
+    if (t == nullptr) { // pool exhausted?
+        SST_PORT_CRIT_EXIT();
+        return 0U; // no timeout armed
+    }
+    m_free = t->m_next;
+    --m_nFree;
+    if (m_nMin > m_nFree) {
+        m_nMin = m_nFree;
+    }
+    t->m_task = task;
+    t->m_evt  = e;
+    t->m_ctr  = ctr;
+#ifdef SST_EVT_POOL
+    BlockPool::ref_(e); // released upon the expiration or cancel()
+#endif
+
+    // insert the timeout at the head of the armed list
+    t->m_prev = nullptr;
+    t->m_next = m_armed;
+    if (m_armed != nullptr) {
+        m_armed->m_prev = t;
+    }
+    m_armed = t;
+    Handle const h = (static_cast<Handle>(t->m_gen) << 16U)
+                     | static_cast<Handle>((t - m_sto) + 1U);
+    SST_PORT_CRIT_EXIT();
+
+    return h;
+}
+//............................................................................
+bool TimeoutPool::cancel(Handle const h) noexcept {
+    std::uint16_t const i = static_cast<std::uint16_t>(h & 0xFFFFU);
+    if (i == 0U) { // the "no timeout" handle (e.g., from a failed arm())?
+        return false;
+    }
+
+    //! @pre the handle must come from this pool
+    DBC_REQUIRE(1500, i <= m_len);
+
+    Timeout * const t = &m_sto[i - 1U];
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    // NOTE: a handle of a timeout that has already expired or has been
+    // canceled refers to an older generation and is ignored
+    bool const armed = (t->m_ctr != 0U)
+                       && (t->m_gen == static_cast<std::uint16_t>(h >> 16U));
+#ifdef SST_EVT_POOL
+    Evt const * const e = t->m_evt;
+#endif
+    if (armed) {
+        release_(t);
+    }
+    SST_PORT_CRIT_EXIT();
+
+#ifdef SST_EVT_POOL
+    if (armed) {
+        gc(e); // drop the reference held by the canceled timeout
+    }
+#endif
+    return armed;
+}
+//............................................................................
+void TimeoutPool::tick(TickDomain const domain) { // static
+    for (TimeoutPool *p = timeoutPool_head[domain];
+         p != nullptr;
+         p = p->m_next)
+    {
+        SST_PORT_CRIT_STAT
+        SST_PORT_CRIT_ENTRY();
+        p->m_cursor = p->m_armed;
+        SST_PORT_CRIT_EXIT();
+
+        for (;;) {
+            // NOTE: the cursor is advanced inside the critical section,
+            // so that canceling the next timeout while the pool is being
+            // processed (e.g., from a preempting task) cannot break the
+            // traversal of the armed list. See TimeoutPool::release_().
+            SST_PORT_CRIT_ENTRY();
+            Timeout * const t = p->m_cursor;
+            if (t == nullptr) { // end of the armed list?
+                SST_PORT_CRIT_EXIT();
+                break;
+            }
+            p->m_cursor = t->m_next;
+            if (t->m_ctr == 1U) { // expiring?
+                Task * const task = t->m_task;
+                Evt const * const e = t->m_evt;
+                p->release_(t);
+                SST_PORT_CRIT_EXIT();
+
+                task->post(e);
+#ifdef SST_EVT_POOL
+                gc(e); // drop the reference held by the expired timeout
+#endif
+            }
+            else { // timing out
+                --t->m_ctr;
+                SST_PORT_CRIT_EXIT();
+            }
+        }
+    }
+}
+//............................................................................
+void TimeoutPool::release_(Timeout * const t) noexcept {
+    // NOTE: called inside a critical section
+
+    // unlink the timeout from the armed list
+    if (m_cursor == t) { // releasing the next timeout to process?
+        m_cursor = t->m_next;
+    }
+    if (t->m_prev != nullptr) {
+        t->m_prev->m_next = t->m_next;
+    }
+    else {
+        m_armed = t->m_next;
+    }
+    if (t->m_next != nullptr) {
+        t->m_next->m_prev = t->m_prev;
+    }
+
+    // return the timeout to the free list
+    t->m_ctr  = 0U;
+    ++t->m_gen; // invalidate all outstanding handles
+    t->m_next = m_free;
+    m_free = t;
+    ++m_nFree;
+}
+
+//----------------------------------------------------------------------------
+TickTask::TickTask(TickDomain domain) {
+    //! @pre the tick domain must be in range
+    DBC_REQUIRE(1000, domain < SST_MAX_TICK_DOMAIN);
+
+    m_nTicks = 0U;
+    m_domain = domain;
+}
+//............................................................................
+void TickTask::start(TaskPrio prio) {
+    Task::start(prio, m_qSto, ARRAY_NELEM(m_qSto), nullptr);
+}
+//............................................................................
+void TickTask::tick(void) noexcept {
+    static Evt const tickEvt = { 0U };
+
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    bool const idle = (m_nTicks == 0U);
+    ++m_nTicks;
+    SST_PORT_CRIT_EXIT();
+
+    // NOTE: the task is activated only when the first unprocessed tick
+    // arrives, so its queue never holds more than one event
+    if (idle) {
+        post(&tickEvt);
+    }
+}
+//............................................................................
+void TickTask::init(Evt const * const /*ie*/) {
+}
+//............................................................................
+void TickTask::dispatch(Evt const * const /*e*/) {
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    TCtr n = m_nTicks;
+    m_nTicks = 0U;
+    SST_PORT_CRIT_EXIT();
+
+    for (; n > 0U; --n) { // catch up with all the elapsed ticks
+        TimeEvt::tick(m_domain);
+    }
+}
+
+#ifdef SST_PORT_STACK_PTR
+// SST stack facilities ------------------------------------------------------
+void stackPaint(void * const stackBottom, void * const stackTop) noexcept {
+    std::uint32_t * const sp = SST_PORT_STACK_PTR();
+
+    //! @pre the current stack pointer must be within the stack
+    DBC_REQUIRE(3200, (stackBottom < sp) && (sp <= stackTop));
+
+    stack_bottom = static_cast<std::uint32_t *>(stackBottom);
+    stack_top    = static_cast<std::uint32_t *>(stackTop);
+
+    // NOTE: paint only below the current stack pointer, which is not used
+    // yet, but must not be used by interrupts during the painting either.
+    // Therefore, SST::stackPaint() should be called at the beginning of
+    // main(), before enabling interrupts.
+    for (std::uint32_t *p = stack_bottom; p < sp; ++p) {
+        *p = STACK_PAINT;
+    }
+}
+//............................................................................
+std::uint32_t stackUsed(void) noexcept {
+    // the stack grows down, so the deepest use is the lowest overwritten
+    // word above the stack bottom (the high watermark)
+    std::uint32_t const *p = stack_bottom;
+    while ((p < stack_top) && (*p == STACK_PAINT)) {
+        ++p;
     }
+    return static_cast<std::uint32_t>(stack_top - p) * sizeof(*p);
 }
+#endif // SST_PORT_STACK_PTR
 
 } // namespace SST
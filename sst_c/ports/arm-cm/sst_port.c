@@ -93,6 +93,11 @@ void SST_Task_setPrio(SST_Task * const me, SST_TaskPrio prio) {
     /* convert the SST direct priority (1,2,..) to NVIC priority... */
     uint32_t nvic_prio = ((0xFFU >> nvic_prio_shift) + 1U - prio)
                          << nvic_prio_shift;
+#if (__ARM_ARCH != 6) && defined SST_PORT_BASEPRI
+    /*! @pre the Task priority must be masked by the critical section */
+    DBC_REQUIRE(210, nvic_prio
+        >= ((SST_PORT_BASEPRI) & (0xFFU << nvic_prio_shift) & 0xFFU));
+#endif
 
     SST_PORT_CRIT_STAT
     SST_PORT_CRIT_ENTRY();
@@ -164,9 +169,15 @@ SST_LockKey SST_Task_lock(SST_TaskPrio ceiling) {
                          << nvic_prio_shift;
     SST_LockKey basepri_; /* initialized in the following asm() instruction */
     __asm volatile ("mrs %0,BASEPRI" : "=r" (basepri_) :: );
-    if (basepri_ > nvic_prio) { /* current priority lower than the ceiling? */
-        __asm volatile ("cpsid i\n msr BASEPRI,%0\n cpsie i"
-                        :: "r" (nvic_prio) : );
+    /* current priority lower than the ceiling (or BASEPRI not set)? */
+    if ((basepri_ == 0U) || (basepri_ > nvic_prio)) {
+        /* NOTE: PRIMASK is saved and restored (not cleared by "cpsie i"),
+        * so the lock does not enable interrupts disabled by the caller
+        */
+        uint32_t primask_; /* initialized in the following asm() */
+        __asm volatile ("mrs %0,PRIMASK" : "=r" (primask_) :: );
+        __asm volatile ("cpsid i\n msr BASEPRI,%0\n msr PRIMASK,%1"
+                        :: "r" (nvic_prio), "r" (primask_) : "memory");
     }
     return basepri_;
 #endif
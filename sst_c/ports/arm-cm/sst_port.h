@@ -37,10 +37,41 @@
     void SST_Task_setIRQ(SST_Task * const me, uint8_t irq); \
     void SST_Task_setPrio(SST_Task * const me, SST_TaskPrio prio);
 
-/* SST-PORT critical section */
-#define SST_PORT_CRIT_STAT
-#define SST_PORT_CRIT_ENTRY() __asm volatile ("cpsid i")
-#define SST_PORT_CRIT_EXIT()  __asm volatile ("cpsie i")
+/* SST-PORT critical section
+* NOTE: the critical section saves and restores the interrupt masking
+* state, so it can nest and can be used with interrupts already disabled.
+*/
+#if (__ARM_ARCH != 6) && defined SST_PORT_BASEPRI /* ARMv7-M+ with BASEPRI? */
+/* The critical section raises BASEPRI to SST_PORT_BASEPRI (the priority
+* written to the BASEPRI register, e.g., 0x20 for the NVIC priority level 1
+* with 3 implemented priority bits). The interrupts with the numerically
+* lower (more urgent) priorities are never masked by SST ("zero-latency"),
+* but they must not call any SST services. All SST tasks and the ISRs
+* calling SST services must be at priorities SST_PORT_BASEPRI or lower.
+* The BASEPRI write is surrounded by "cpsid i"/PRIMASK restore to work
+* around the Cortex-M7 r0p1 erratum 837070 (interrupt taken after the
+* write to BASEPRI). PRIMASK is restored rather than cleared, so the
+* critical section does not enable interrupts disabled by the caller.
+*/
+#define SST_PORT_CRIT_STAT    uint32_t crit_stat_;
+#define SST_PORT_CRIT_ENTRY() do { \
+    uint32_t primask_; \
+    __asm volatile ("mrs %0,BASEPRI" : "=r" (crit_stat_) :: ); \
+    __asm volatile ("mrs %0,PRIMASK" : "=r" (primask_) :: ); \
+    __asm volatile ("cpsid i\n msr BASEPRI_MAX,%0\n msr PRIMASK,%1" \
+                    :: "r" (SST_PORT_BASEPRI), "r" (primask_) : "memory"); \
+} while (0)
+#define SST_PORT_CRIT_EXIT() \
+    __asm volatile ("msr BASEPRI,%0" :: "r" (crit_stat_) : "memory")
+#else /* PRIMASK (all interrupts) */
+#define SST_PORT_CRIT_STAT    uint32_t crit_stat_;
+#define SST_PORT_CRIT_ENTRY() do { \
+    __asm volatile ("mrs %0,PRIMASK" : "=r" (crit_stat_) :: ); \
+    __asm volatile ("cpsid i" ::: "memory"); \
+} while (0)
+#define SST_PORT_CRIT_EXIT() \
+    __asm volatile ("msr PRIMASK,%0" :: "r" (crit_stat_) : "memory")
+#endif
 
 /* SST-PORT pend the Task after posting an event
 * NOTE: executed inside SST critical section.
@@ -0,0 +1,189 @@
+//============================================================================
+// Super-Simple Tasker (SST/C++) Example
+//
+// Copyright (C) 2006-2023 Quantum Leaps, <state-machine.com>.
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//============================================================================
+#include "sst.hpp"      // SST framework
+#include "dbc_assert.h" // for DBC_fault_handler()
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// NOTE:
+// This example runs on the host with the simulation port (ports/sim) and
+// demonstrates the execution-time budgets of the tasks (SST_TASK_BUDGET).
+// The virtual clock of the simulation advances only in SST::simAdvance(),
+// which stands for the CPU time used by the code, so every run produces
+// exactly the same results. The example exits with 0 when all the budget
+// policies behave as expected.
+
+namespace { // unnamed namespace
+
+enum Signals : SST::Signal {
+    WORK_SIG = 1U,
+    BURST_SIG,
+    OVERRUN_SIG,
+};
+
+// event with the amount of work [virtual clock units]
+struct WorkEvt : public SST::Evt {
+    std::uint32_t len;
+};
+
+//............................................................................
+// the task under the budget
+class Worker : public SST::Task {
+public:
+    void init(SST::Evt const * const /*ie*/) override {}
+    void dispatch(SST::Evt const * const e) override {
+        SST::simAdvance(static_cast<WorkEvt const *>(e)->len); // "work"
+    }
+};
+
+// higher-priority task preempting the Worker
+class Burst : public SST::Task {
+public:
+    void init(SST::Evt const * const /*ie*/) override {}
+    void dispatch(SST::Evt const * const /*e*/) override {
+        SST::simAdvance(20U); // time that must not count against the Worker
+    }
+};
+
+// supervisor notified about the overruns (BUDGET_NOTIFY)
+class Supervisor : public SST::Task {
+public:
+    std::uint16_t nNotified;
+    void init(SST::Evt const * const /*ie*/) override { nNotified = 0U; }
+    void dispatch(SST::Evt const * const /*e*/) override { ++nNotified; }
+};
+
+Worker     l_worker;
+Burst      l_burst;
+Supervisor l_supervisor;
+
+SST::Evt const l_burstEvt   = { BURST_SIG };
+SST::Evt const l_overrunEvt = { OVERRUN_SIG };
+
+bool l_burstArmed; // post the burst from the next emulated tick ISR?
+bool l_faultExpected;
+std::uint32_t l_faultStart; // virtual time of the faulting activation
+int  l_nErrors;
+
+//............................................................................
+void tickIsr(void) { // emulated periodic tick ISR
+    if (l_burstArmed) {
+        l_burstArmed = false;
+        l_burst.post(&l_burstEvt);
+    }
+    SST::Task::checkBudget(); // detect overruns before the activation ends
+}
+//............................................................................
+void work(std::uint32_t const len) {
+    static WorkEvt e; // NOTE: dispatched synchronously before the next use
+    e.sig = WORK_SIG;
+    e.len = len;
+    l_worker.post(&e);
+}
+//............................................................................
+void check(bool const ok, char const * const what) {
+    std::printf("%-48s %s\n", what, ok ? "ok" : "FAILED");
+    if (!ok) {
+        ++l_nErrors;
+    }
+}
+
+} // unnamed namespace
+
+//............................................................................
+int main() {
+    SST::init(); // initialize the SST kernel
+
+    static SST::Evt const *workerQSto[4];
+    l_worker.setBudget(10U, SST::BUDGET_COUNT);
+    l_worker.start(1U, workerQSto, ARRAY_NELEM(workerQSto), nullptr);
+
+    static SST::Evt const *burstQSto[2];
+    l_burst.start(2U, burstQSto, ARRAY_NELEM(burstQSto), nullptr);
+
+    static SST::Evt const *supervisorQSto[4];
+    l_supervisor.start(3U, supervisorQSto, ARRAY_NELEM(supervisorQSto),
+                       nullptr);
+
+    SST::start();
+    SST::simSetIsr(&tickIsr, 1U); // tick every virtual clock unit
+
+    // BUDGET_COUNT: only the activations over the budget are counted
+    work(8U);
+    check(l_worker.getNOverruns() == 0U, "BUDGET_COUNT: within the budget");
+    work(15U);
+    check(l_worker.getNOverruns() == 1U, "BUDGET_COUNT: overrun counted");
+
+    // the time preempted by a higher-priority task does not count
+    l_burstArmed = true;
+    work(8U); // 8 units of own work + 20 units of the Burst
+    check(l_worker.getNOverruns() == 1U,
+          "preempted time excluded from the budget");
+
+    // BUDGET_NOTIFY: the supervisor is notified of every overrun
+    l_worker.setBudget(10U, SST::BUDGET_NOTIFY,
+                       &l_supervisor, &l_overrunEvt);
+    work(15U);
+    check((l_worker.getNOverruns() == 2U) && (l_supervisor.nNotified == 1U),
+          "BUDGET_NOTIFY: supervisor notified");
+
+    // BUDGET_FAULT: the tick ISR detects the overrun during the activation
+    // and the DBC fault handler is called (which ends this example)
+    l_worker.setBudget(10U, SST::BUDGET_FAULT);
+    l_faultExpected = true;
+    l_faultStart = SST::simTimestamp();
+    work(1000U);
+    check(false, "BUDGET_FAULT: fault handler called");
+    return EXIT_FAILURE;
+}
+
+//============================================================================
+namespace SST {
+
+//............................................................................
+void onStart(void) {
+}
+//............................................................................
+void onIdle(void) {
+}
+
+} // namespace SST
+
+//............................................................................
+extern "C" {
+
+DBC_NORETURN
+void DBC_fault_handler(char const * const module, int const label) {
+    bool const ok = l_faultExpected
+                    && (std::strcmp(module, "sst") == 0) && (label == 2100)
+                    && ((SST::simTimestamp() - l_faultStart) <= 12U);
+    check(ok, "BUDGET_FAULT: fault handler called");
+    std::exit(((l_nErrors == 0) && ok) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+} // extern "C"
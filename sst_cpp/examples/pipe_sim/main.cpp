@@ -0,0 +1,230 @@
+//============================================================================
+// Super-Simple Tasker (SST/C++) Example
+//
+// Copyright (C) 2006-2023 Quantum Leaps, <state-machine.com>.
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//============================================================================
+#include "sst.hpp"      // SST framework
+#include "sst_pipe.hpp" // SST pipeline links
+#include "dbc_assert.h" // for DBC_fault_handler()
+
+#include <cstdio>
+#include <cstdlib>
+
+// NOTE:
+// This example runs on the host with the simulation port (ports/sim) and
+// passes buffer events (SST_EVT_POOL) through a pipeline:
+// - the tick ISR (the source) produces bursts of buffer events: it
+//   allocates a buffer event, writes a sequence number into it and sends
+//   it over the first link (which cannot hold events, so the source drops
+//   the events when the pipeline is full)
+// - the Filter stage processes the buffer in place and forwards the same
+//   event over the second link, which holds it while the Sink is busy
+// - the slow Sink stage checks the buffer contents
+// The held buffer events must stay allocated while they wait in the link,
+// although the Filter has finished the dispatch of the event, so the Sink
+// must receive every buffer intact and in order.
+
+namespace { // unnamed namespace
+
+constexpr std::uint32_t TICK_PERIOD = 10U; // virtual clock units
+constexpr std::uint32_t SINK_TIME   = 25U; // execution time of the Sink
+constexpr std::uint32_t BURST_LEN   = 4U;  // ticks producing events
+constexpr std::uint32_t BURST_TICKS = 10U; // ticks between the bursts
+constexpr std::uint32_t RUN_TIME    = 1000U; // time of main()
+constexpr std::uint16_t N_BLOCKS    = 4U;
+
+enum Signals : SST::Signal {
+    DATA_SIG = 1U,
+    CREDIT_SIG,
+};
+
+// pool of the buffer events
+SST::BlockPool l_pool;
+std::uint32_t  l_poolSto[N_BLOCKS][(sizeof(SST::BufEvt) + 8U + 3U) / 4U];
+
+// the pipeline links
+class Filter;
+class Sink;
+extern Filter l_filter;
+extern Sink   l_sink;
+SST::Evt const l_creditEvt = { CREDIT_SIG };
+SST::Evt const *l_heldSto[1];
+extern SST::PipeLink l_link1; // source --> Filter
+extern SST::PipeLink l_link2; // Filter --> Sink
+
+// statistics
+std::uint32_t l_nTicks;
+std::uint32_t l_nProduced;
+std::uint32_t l_nNoBlock;
+std::uint32_t l_nDropped;
+std::uint32_t l_nHeld;
+std::uint32_t l_nReceived;
+std::uint32_t l_nCorrupt;
+std::uint32_t l_lastSeq;
+
+//............................................................................
+void put32(std::uint8_t * const p, std::uint32_t const x) {
+    p[0] = static_cast<std::uint8_t>(x);
+    p[1] = static_cast<std::uint8_t>(x >> 8U);
+    p[2] = static_cast<std::uint8_t>(x >> 16U);
+    p[3] = static_cast<std::uint8_t>(x >> 24U);
+}
+//............................................................................
+std::uint32_t get32(std::uint8_t const * const p) {
+    return static_cast<std::uint32_t>(p[0])
+           | (static_cast<std::uint32_t>(p[1]) << 8U)
+           | (static_cast<std::uint32_t>(p[2]) << 16U)
+           | (static_cast<std::uint32_t>(p[3]) << 24U);
+}
+
+//............................................................................
+class Filter : public SST::Task {
+public:
+    void init(SST::Evt const * const /*ie*/) override {}
+    void dispatch(SST::Evt const * const e) override {
+        if (e->sig == CREDIT_SIG) { // held output delivered downstream?
+            l_link1.done(); // release the corresponding input
+            return;
+        }
+        // process the buffer in place and forward the same event
+        SST::BufEvt *buf = const_cast<SST::BufEvt *>(
+            static_cast<SST::BufEvt const *>(e));
+        put32(&buf->data()[4], ~get32(&buf->data()[0]));
+        buf->len = 8U;
+        if (l_link2.send(buf) == SST::PipeLink::HELD) {
+            ++l_nHeld;
+        }
+        else {
+            l_link1.done(); // release the input (output sent or dropped)
+        }
+    }
+};
+
+//............................................................................
+class Sink : public SST::Task {
+public:
+    void init(SST::Evt const * const /*ie*/) override {}
+    void dispatch(SST::Evt const * const e) override {
+        SST::BufEvt const *buf = static_cast<SST::BufEvt const *>(e);
+        std::uint32_t const seq = get32(&buf->data()[0]);
+
+        SST::simAdvance(SINK_TIME); // "work" with the buffer
+
+        // the buffer must be intact and in order after the "work"
+        if ((buf->len != 8U) || (get32(&buf->data()[4]) != ~seq)
+            || (get32(&buf->data()[0]) != seq) || (seq <= l_lastSeq))
+        {
+            ++l_nCorrupt;
+        }
+        l_lastSeq = seq;
+        ++l_nReceived;
+        l_link2.done();
+    }
+};
+
+Filter l_filter;
+Sink   l_sink;
+SST::PipeLink l_link1(nullptr, &l_filter, 1U, nullptr);
+SST::PipeLink l_link2(&l_filter, &l_sink, 1U, &l_creditEvt,
+                      l_heldSto, ARRAY_NELEM(l_heldSto));
+
+//............................................................................
+void tickIsr(void) { // emulated periodic ISR (the source of the pipeline)
+    ++l_nTicks;
+    if ((l_nTicks % BURST_TICKS) >= BURST_LEN) { // outside of the burst?
+        return;
+    }
+    SST::BufEvt * const buf = l_pool.alloc(DATA_SIG);
+    if (buf == nullptr) {
+        ++l_nNoBlock;
+        return;
+    }
+    ++l_nProduced;
+    put32(&buf->data()[0], l_nProduced);
+    buf->len = 4U;
+    if (l_link1.send(buf) == SST::PipeLink::DROPPED) {
+        ++l_nDropped;
+    }
+}
+
+} // unnamed namespace
+
+//............................................................................
+int main() {
+    SST::init(); // initialize the SST kernel
+
+    l_pool.init(l_poolSto, sizeof(l_poolSto), sizeof(l_poolSto[0]));
+
+    static SST::Evt const *sinkQSto[1]; // credits of l_link2
+    l_sink.start(1U, sinkQSto, ARRAY_NELEM(sinkQSto), nullptr);
+
+    // credits of l_link1 + credit events for the held events of l_link2
+    static SST::Evt const *filterQSto[1 + ARRAY_NELEM(l_heldSto)];
+    l_filter.start(2U, filterQSto, ARRAY_NELEM(filterQSto), nullptr);
+
+    SST::start();
+    SST::simSetIsr(&tickIsr, TICK_PERIOD);
+    SST::simAdvance(RUN_TIME);
+    SST::simSetIsr(nullptr, 0U); // stop the source
+    SST::simAdvance(4U * SINK_TIME); // drain the pipeline
+
+    std::printf("produced %u, dropped %u, held %u, received %u, "
+                "corrupt %u, no block %u, free blocks %u/%u\n",
+                static_cast<unsigned>(l_nProduced),
+                static_cast<unsigned>(l_nDropped),
+                static_cast<unsigned>(l_nHeld),
+                static_cast<unsigned>(l_nReceived),
+                static_cast<unsigned>(l_nCorrupt),
+                static_cast<unsigned>(l_nNoBlock),
+                static_cast<unsigned>(l_pool.getNFree()),
+                static_cast<unsigned>(N_BLOCKS));
+
+    // every held buffer must arrive intact and all blocks must be free
+    bool const ok = (l_nHeld > 0U) && (l_nCorrupt == 0U)
+                    && (l_nReceived + l_nDropped == l_nProduced)
+                    && (l_pool.getNFree() == N_BLOCKS);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//============================================================================
+namespace SST {
+
+//............................................................................
+void onStart(void) {
+}
+//............................................................................
+void onIdle(void) {
+}
+
+} // namespace SST
+
+//............................................................................
+extern "C" {
+
+DBC_NORETURN
+void DBC_fault_handler(char const * const module, int const label) {
+    std::printf("assertion failed in %s:%d\n", module, label);
+    std::exit(EXIT_FAILURE);
+}
+
+} // extern "C"
@@ -0,0 +1,133 @@
+##############################################################################
+# Common Makefile rules for the SST/C++ host simulation examples, GNU
+# Last Updated for Version: 2.0.0
+# Date of the Last Update:  2023-01-22
+#
+#                    Q u a n t u m  L e a P s
+#                    ------------------------
+#                    Modern Embedded Software
+#
+# Copyright (C) 2005 Quantum Leaps, LLC. All rights reserved.
+#
+# SPDX-License-Identifier: MIT
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+##############################################################################
+# NOTE:
+# This file is included from the gnu/host.mak of every host simulation
+# example, which defines:
+# PROJECT  -- the name of the example
+# DEFINES  -- the SST configuration macros of the example (-D...)
+# SST_SRCS -- the optional SST modules used by the example (sst_xxx.cpp)
+# The examples run on the host computer with the SST simulation port,
+# so they need only the host GNU C++ compiler (g++).
+#
+
+#-----------------------------------------------------------------------------
+# target name
+#
+TARGET  := host
+
+#-----------------------------------------------------------------------------
+# project directories
+#
+SST_DIR      := ../../..
+SST_PORT_DIR := $(SST_DIR)/ports/sim
+
+# list of all source directories used by this project
+VPATH = .. \
+	$(SST_DIR)/src \
+	$(SST_PORT_DIR)
+
+# list of all include directories needed by this project
+INCLUDES  = -I. \
+	-I$(SST_DIR)/../include \
+	-I$(SST_PORT_DIR)
+
+#-----------------------------------------------------------------------------
+# project files
+#
+
+# C++ source files
+CPP_SRCS := \
+	sst.cpp \
+	$(SST_SRCS) \
+	sst_port.cpp \
+	main.cpp
+
+OUTPUT    := $(PROJECT)
+
+#-----------------------------------------------------------------------------
+# host GNU toolset
+#
+CPP   := g++
+LINK  := g++
+
+MKDIR := mkdir
+RM    := rm
+
+#-----------------------------------------------------------------------------
+# build options
+#
+BIN_DIR := build_$(TARGET)
+
+CPPFLAGS = -c -g -std=c++11 -Wall -Wextra \
+	-O $(INCLUDES) $(DEFINES)
+
+CPP_OBJS     := $(patsubst %.cpp,%.o,$(notdir $(CPP_SRCS)))
+TARGET_EXE   := $(BIN_DIR)/$(OUTPUT)
+CPP_OBJS_EXT := $(addprefix $(BIN_DIR)/, $(CPP_OBJS))
+
+# create $(BIN_DIR) if it does not exist
+ifeq ("$(wildcard $(BIN_DIR))","")
+$(shell $(MKDIR) $(BIN_DIR))
+endif
+
+#-----------------------------------------------------------------------------
+# rules
+#
+
+.PHONY : all run norun clean show
+
+ifeq ($(MAKECMDGOALS),norun)
+all : $(TARGET_EXE)
+norun : all
+else
+all : $(TARGET_EXE) run
+endif
+
+run : $(TARGET_EXE)
+	$(TARGET_EXE)
+
+$(TARGET_EXE) : $(CPP_OBJS_EXT)
+	$(LINK) -o $@ $^
+
+$(BIN_DIR)/%.o : %.cpp
+	$(CPP) $(CPPFLAGS) $< -o $@
+
+clean :
+	-$(RM) $(BIN_DIR)/*.o \
+	$(TARGET_EXE)
+
+show :
+	@echo PROJECT = $(PROJECT)
+	@echo TARGET = $(TARGET)
+	@echo CPP_SRCS = $(CPP_SRCS)
+	@echo INCLUDES = $(INCLUDES)
+	@echo DEFINES = $(DEFINES)
@@ -0,0 +1,178 @@
+//============================================================================
+// Super-Simple Tasker (SST/C++) Example
+//
+// Copyright (C) 2006-2023 Quantum Leaps, <state-machine.com>.
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//============================================================================
+#include "sst.hpp"      // SST framework
+#include "dbc_assert.h" // for DBC_fault_handler()
+
+#include <cstdio>
+#include <cstdlib>
+
+// NOTE:
+// This example runs on the host with the simulation port (ports/sim) and
+// compares the periodic time events armed in phase (TimeEvt::arm()) with
+// the staggered ones (TimeEvt::armStaggered()). The virtual clock of the
+// simulation advances only in SST::simAdvance(), which stands for the CPU
+// time used by the tasks, so the trace is exactly repeatable. For both
+// arming modes, the example reports:
+// - the peak tick cost: the longest busy period of the tasks after a tick
+// - the worst-case response time of the tasks: the worst post-to-dispatch
+//   latency (SST_LATENCY) plus the execution time of the task
+
+namespace { // unnamed namespace
+
+constexpr std::uint32_t TICK_PERIOD = 10U; // virtual clock units
+constexpr std::uint32_t WORK_TIME   = 3U;  // execution time of each task
+constexpr SST::TCtr     INTERVAL    = 16U; // [ticks]
+constexpr std::uint8_t  N_TASKS     = 8U;
+constexpr std::uint32_t N_TICKS     = 10U * INTERVAL; // ticks per mode
+
+enum Signals : SST::Signal {
+    TIMEOUT_SIG = 1U,
+};
+
+// trace of the busy periods
+std::uint8_t  l_depth;     // nesting of the running activations
+std::uint32_t l_lastEnd;   // end of the last activation
+std::uint32_t l_busyStart; // start of the current busy period
+std::uint32_t l_peakBusy;  // the longest busy period
+
+//............................................................................
+class Periodic : public SST::Task {
+public:
+    Periodic() : m_te(TIMEOUT_SIG, this) {}
+    SST::TimeEvt *getTimeEvt(void) noexcept { return &m_te; }
+
+    void init(SST::Evt const * const /*ie*/) override {}
+    void dispatch(SST::Evt const * const /*e*/) override {
+        std::uint32_t const start = SST::simTimestamp();
+        if ((l_depth == 0U) && (start != l_lastEnd)) { // CPU was idle?
+            l_busyStart = start; // a new busy period
+        }
+        ++l_depth;
+
+        SST::simAdvance(WORK_TIME); // "work"
+
+        --l_depth;
+        l_lastEnd = SST::simTimestamp();
+        if (l_peakBusy < (l_lastEnd - l_busyStart)) {
+            l_peakBusy = l_lastEnd - l_busyStart;
+        }
+    }
+
+private:
+    SST::TimeEvt m_te;
+};
+
+Periodic l_tasks[N_TASKS];
+SST::LatencyHist l_hist[N_TASKS];
+
+//............................................................................
+void tickIsr(void) { // emulated periodic tick ISR
+    SST::TimeEvt::tick();
+}
+//............................................................................
+std::uint32_t run(bool const staggered) {
+    for (std::uint_fast8_t i = 0U; i < N_TASKS; ++i) {
+        SST::TimeEvt * const te = l_tasks[i].getTimeEvt();
+        if (staggered) {
+            te->armStaggered(INTERVAL);
+        }
+        else {
+            te->arm(INTERVAL, INTERVAL);
+        }
+    }
+    SST::setLatencyHist(l_hist, N_TASKS); // clear the latency statistics
+    l_peakBusy = 0U;
+
+    SST::simAdvance(N_TICKS * TICK_PERIOD);
+
+    std::uint32_t worst = 0U;
+    for (std::uint_fast8_t i = 0U; i < N_TASKS; ++i) {
+        l_tasks[i].getTimeEvt()->disarm();
+        if ((l_hist[i].task != nullptr) && (worst < l_hist[i].max)) {
+            worst = l_hist[i].max;
+        }
+    }
+    worst += WORK_TIME;
+
+    std::printf("%-12s %16u %20u\n", staggered ? "staggered" : "in phase",
+                static_cast<unsigned>(l_peakBusy),
+                static_cast<unsigned>(worst));
+    return (l_peakBusy << 16U) | worst;
+}
+
+} // unnamed namespace
+
+//............................................................................
+int main() {
+    SST::init(); // initialize the SST kernel
+
+    static SST::Evt const *qSto[N_TASKS][2];
+    static SST::LatencyStamp latSto[N_TASKS][2];
+    for (std::uint_fast8_t i = 0U; i < N_TASKS; ++i) {
+        l_tasks[i].setLatencyBuf(latSto[i]);
+        l_tasks[i].start(static_cast<SST::TaskPrio>(i + 1U),
+                         qSto[i], ARRAY_NELEM(qSto[i]), nullptr);
+    }
+
+    SST::start();
+    SST::simSetIsr(&tickIsr, TICK_PERIOD);
+
+    std::printf("%u tasks, interval %u ticks, tick %u, work %u "
+                "(virtual clock units)\n",
+                N_TASKS, INTERVAL, TICK_PERIOD, WORK_TIME);
+    std::printf("%-12s %16s %20s\n", "arming", "peak tick cost",
+                "worst response time");
+    std::uint32_t const inPhase   = run(false);
+    std::uint32_t const staggered = run(true);
+
+    // the staggering must reduce both the peak cost and the response time
+    bool const ok = ((staggered >> 16U) < (inPhase >> 16U))
+                    && ((staggered & 0xFFFFU) < (inPhase & 0xFFFFU));
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//============================================================================
+namespace SST {
+
+//............................................................................
+void onStart(void) {
+}
+//............................................................................
+void onIdle(void) {
+}
+
+} // namespace SST
+
+//............................................................................
+extern "C" {
+
+DBC_NORETURN
+void DBC_fault_handler(char const * const module, int const label) {
+    std::printf("assertion failed in %s:%d\n", module, label);
+    std::exit(EXIT_FAILURE);
+}
+
+} // extern "C"
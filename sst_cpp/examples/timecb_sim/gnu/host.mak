@@ -0,0 +1,49 @@
+##############################################################################
+# Makefile for the SST/C++ timecb_sim example (host simulation), GNU
+# Last Updated for Version: 2.0.0
+# Date of the Last Update:  2023-01-22
+#
+#                    Q u a n t u m  L e a P s
+#                    ------------------------
+#                    Modern Embedded Software
+#
+# Copyright (C) 2005 Quantum Leaps, LLC. All rights reserved.
+#
+# SPDX-License-Identifier: MIT
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+##############################################################################
+# examples of invoking this Makefile:
+# make -f host.mak        # build and run the example
+# make -f host.mak norun  # only build the example
+# make -f host.mak clean
+#
+# NOTE:
+# This example runs on the host computer with the SST simulation port,
+# so it needs only the host GNU C++ compiler (g++).
+#
+
+#-----------------------------------------------------------------------------
+# the example (see ../../sim.mak for the common rules)
+#
+PROJECT  := timecb_sim
+DEFINES  :=
+SST_SRCS :=
+
+include ../../sim.mak
@@ -0,0 +1,209 @@
+//============================================================================
+// Super-Simple Tasker (SST/C++) Example
+//
+// Copyright (C) 2006-2023 Quantum Leaps, <state-machine.com>.
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//============================================================================
+#include "sst.hpp"      // SST framework
+#include "dbc_assert.h" // for DBC_fault_handler()
+
+#include <cstdio>
+#include <cstdlib>
+
+// NOTE:
+// This example runs on the host with the simulation port (ports/sim) and
+// traces the same periodic action performed in two ways:
+// - TimeEvt: the tick posts an event and activates the low-priority task
+//   Blinky, which performs the action in its dispatch()
+// - TimeCb: the tick calls the action directly, without posting any event
+// The tick ISR also posts an event to the high-priority task Busy, which
+// stands for the application load. The virtual clock of the simulation
+// advances only in SST::simAdvance(), so the trace is exactly repeatable.
+// For both paths, the example reports the number of task activations
+// caused by the action, the worst delay from the tick to the action and
+// the jitter of the action period.
+
+namespace { // unnamed namespace
+
+constexpr std::uint32_t TICK_PERIOD = 10U; // virtual clock units
+constexpr std::uint32_t BUSY_TIME   = 4U;  // execution time of Busy
+constexpr std::uint32_t ACTION_TIME = 1U;  // execution time of the action
+constexpr SST::TCtr     INTERVAL    = 5U;  // [ticks]
+constexpr std::uint32_t RUN_TIME    = 1000U; // time of main() per path
+
+enum Signals : SST::Signal {
+    TIMEOUT_SIG = 1U,
+    BUSY_SIG,
+};
+
+// trace of the periodic action
+std::uint32_t l_tickTime;    // timestamp of the last tick
+std::uint32_t l_lastAction;  // timestamp of the last action
+std::uint32_t l_nActions;    // number of the actions
+std::uint32_t l_worstDelay;  // worst delay from the tick to the action
+std::uint32_t l_minPeriod;   // shortest period of the action
+std::uint32_t l_maxPeriod;   // longest period of the action
+std::uint32_t l_nActivations; // activations of the task Blinky
+
+//............................................................................
+void action(void * /*par*/) { // the periodic action
+    std::uint32_t const now = SST::simTimestamp();
+    if (l_worstDelay < (now - l_tickTime)) {
+        l_worstDelay = now - l_tickTime;
+    }
+    if (l_nActions != 0U) {
+        std::uint32_t const period = now - l_lastAction;
+        if (l_minPeriod > period) {
+            l_minPeriod = period;
+        }
+        if (l_maxPeriod < period) {
+            l_maxPeriod = period;
+        }
+    }
+    ++l_nActions;
+    l_lastAction = now;
+
+    SST::simAdvance(ACTION_TIME); // "work"
+}
+
+//............................................................................
+class Blinky : public SST::Task { // performs the action with TimeEvt
+public:
+    Blinky() : m_te(TIMEOUT_SIG, this) {}
+    SST::TimeEvt *getTimeEvt(void) noexcept { return &m_te; }
+
+    void init(SST::Evt const * const /*ie*/) override {}
+    void dispatch(SST::Evt const * const /*e*/) override {
+        ++l_nActivations;
+        action(nullptr);
+    }
+
+private:
+    SST::TimeEvt m_te;
+};
+
+//............................................................................
+class Busy : public SST::Task { // the application load
+public:
+    void init(SST::Evt const * const /*ie*/) override {}
+    void dispatch(SST::Evt const * const /*e*/) override {
+        SST::simAdvance(BUSY_TIME); // "work"
+    }
+};
+
+Blinky l_blinky;
+Busy   l_busy;
+SST::TimeCb l_timeCb(&action, nullptr);
+
+//............................................................................
+void tickIsr(void) { // emulated periodic tick ISR
+    static SST::Evt const busyEvt = { BUSY_SIG };
+
+    l_tickTime = SST::simTimestamp();
+    l_busy.post(&busyEvt);
+    SST::TimeEvt::tick();
+}
+//............................................................................
+void run(bool const callback) {
+    l_nActions     = 0U;
+    l_worstDelay   = 0U;
+    l_minPeriod    = 0xFFFFFFFFU;
+    l_maxPeriod    = 0U;
+    l_nActivations = 0U;
+    if (callback) {
+        l_timeCb.arm(INTERVAL, INTERVAL);
+    }
+    else {
+        l_blinky.getTimeEvt()->arm(INTERVAL, INTERVAL);
+    }
+
+    SST::simAdvance(RUN_TIME);
+
+    if (callback) {
+        l_timeCb.disarm();
+    }
+    else {
+        l_blinky.getTimeEvt()->disarm();
+    }
+
+    std::printf("%-8s %8u %12u %12u %8u\n",
+                callback ? "TimeCb" : "TimeEvt",
+                static_cast<unsigned>(l_nActions),
+                static_cast<unsigned>(l_nActivations),
+                static_cast<unsigned>(l_worstDelay),
+                static_cast<unsigned>(l_maxPeriod - l_minPeriod));
+}
+
+} // unnamed namespace
+
+//............................................................................
+int main() {
+    SST::init(); // initialize the SST kernel
+
+    static SST::Evt const *blinkyQSto[2];
+    l_blinky.start(1U, blinkyQSto, ARRAY_NELEM(blinkyQSto), nullptr);
+
+    static SST::Evt const *busyQSto[2];
+    l_busy.start(2U, busyQSto, ARRAY_NELEM(busyQSto), nullptr);
+
+    SST::start();
+    SST::simSetIsr(&tickIsr, TICK_PERIOD);
+
+    std::printf("interval %u ticks, tick %u, Busy %u, action %u "
+                "(virtual clock units)\n",
+                INTERVAL, TICK_PERIOD, BUSY_TIME, ACTION_TIME);
+    std::printf("%-8s %8s %12s %12s %8s\n", "path", "actions",
+                "activations", "worst delay", "jitter");
+    run(false);
+    std::uint32_t const evtActions = l_nActions;
+    std::uint32_t const evtDelay   = l_worstDelay;
+    run(true);
+
+    // the callback path must perform the action without any activation
+    // and sooner than the event path
+    bool const ok = (l_nActivations == 0U) && (l_worstDelay < evtDelay)
+                    && (l_nActions == evtActions);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//============================================================================
+namespace SST {
+
+//............................................................................
+void onStart(void) {
+}
+//............................................................................
+void onIdle(void) {
+}
+
+} // namespace SST
+
+//............................................................................
+extern "C" {
+
+DBC_NORETURN
+void DBC_fault_handler(char const * const module, int const label) {
+    std::printf("assertion failed in %s:%d\n", module, label);
+    std::exit(EXIT_FAILURE);
+}
+
+} // extern "C"
@@ -32,6 +32,10 @@
 #define SCB_SYSPRI   ((uint32_t volatile *)0xE000ED14U)
 #define SCB_AIRCR   *((uint32_t volatile *)0xE000ED0CU)
 #define FPU_FPCCR   *((uint32_t volatile *)0xE000EF34U)
+#define DEMCR       *((uint32_t volatile *)0xE000EDFCU)
+#define DWT_CTRL    *((uint32_t volatile *)0xE0001000U)
+#define DWT_CYCCNT  *((uint32_t volatile *)0xE0001004U)
+#define DWT_LAR     *((uint32_t volatile *)0xE0001FB0U)
 
 //............................................................................
 namespace { // unnamed namespace
@@ -41,6 +45,11 @@ DBC_MODULE_NAME("sst_port") // for DBC assertions in this module
 // # of unused interrupt priority bits in NVIC
 static std::uint32_t nvic_prio_shift;
 
+// main stack painted by SST::stackPaint()
+static std::uint32_t *stack_bottom;
+static std::uint32_t *stack_top;
+constexpr std::uint32_t STACK_PAINT = 0xDEADBEEFU; // pattern of unused stack
+
 } // unnamed namespace
 
 namespace SST {
@@ -62,6 +71,16 @@ void init(void) {
     }
     nvic_prio_shift = tmp;
 
+#if (__ARM_ARCH != 6) \
+    && (defined SST_EVT_DEADLINE || defined SST_TASK_BUDGET \
+        || defined SST_LATENCY)
+    // enable the DWT cycle counter for the SST timestamps
+    DEMCR     |= (1U << 24U); // enable the trace and debug blocks (TRCENA)
+    DWT_LAR    = 0xC5ACCE55U; // unlock the DWT (needed on Cortex-M7)
+    DWT_CYCCNT = 0U;
+    DWT_CTRL  |= 1U;          // enable the cycle counter (CYCCNTENA)
+#endif
+
 #if (__ARM_FP != 0)
     // configure the FPU for SST
     FPU_FPCCR |= (1U << 30U)    // automatic FPU state preservation (ASPEN)
@@ -96,6 +115,11 @@ void Task::setPrio(TaskPrio prio) noexcept {
     // convert the SST direct priority (1,2,..) to NVIC priority...
     std::uint32_t irq_prio = ((0xFFU >> nvic_prio_shift) + 1U - prio)
                               << nvic_prio_shift;
+#if (__ARM_ARCH != 6) && defined SST_PORT_BASEPRI
+    //! @pre the Task priority must be masked by the critical section
+    DBC_REQUIRE(210, irq_prio
+        >= ((SST_PORT_BASEPRI) & (0xFFU << nvic_prio_shift) & 0xFFU));
+#endif
 
     SST_PORT_CRIT_STAT
     SST_PORT_CRIT_ENTRY();
@@ -122,6 +146,13 @@ void Task::activate(void) {
     // NOTE: no critical section because me->tail is accessed only
     // from this task
     Evt const *e = m_qBuf[m_tail];
+#ifdef SST_EVT_DEADLINE
+    Timestamp const dl = (m_dlBuf != nullptr) ? m_dlBuf[m_tail] : 0U;
+#endif
+#ifdef SST_LATENCY
+    LatencyStamp const stamp = (m_latBuf != nullptr)
+                               ? m_latBuf[m_tail] : LatencyStamp();
+#endif
     if (m_tail == 0U) { // need to wrap the tail?
         m_tail = m_end; // wrap around
     }
@@ -134,11 +165,40 @@ void Task::activate(void) {
     if ((--m_nUsed) > 0U) {
         *m_nvic_pend = m_nvic_irq; // <=== pend the associated IRQ
     }
+#ifdef SST_SIG_COALESCE
+    unpend_(e); // the signal no longer in the queue
+#endif
+#ifdef SST_QUEUE_WATERMARK
+    bool const resume = drained_();
+#endif
     SST_PORT_CRIT_EXIT();
+#ifdef SST_QUEUE_WATERMARK
+    if (resume) { // drained to the low-watermark?
+        m_wmProducer->post(m_resumeEvt);
+    }
+#endif
 
+#ifdef SST_LATENCY
+    if (m_latBuf != nullptr) {
+        recordLatency_(e, stamp);
+    }
+#endif
+#ifdef SST_TASK_BUDGET
+    budgetEnter_();
+#endif
     // dispatch the received event to this task
     dispatch(e); // virtual call
-    // TBD: implement event recycling
+#ifdef SST_TASK_BUDGET
+    budgetExit_();
+#endif
+#ifdef SST_EVT_DEADLINE
+    if (dl != 0U) { // deadline to check?
+        checkDeadline_(e, dl);
+    }
+#endif
+#ifdef SST_EVT_POOL
+    gc(e); // recycle the event
+#endif
 }
 //............................................................................
 void Task::setIRQ(std::uint32_t irq) noexcept {
@@ -167,9 +227,14 @@ LockKey Task::lock(TaskPrio ceiling) {
                          << nvic_prio_shift;
     LockKey basepri_; // initialized in the following asm() instruction
     __asm volatile ("mrs %0,BASEPRI" : "=r" (basepri_) :: );
-    if (basepri_ > nvic_prio) { // current priority lower than the ceiling?
-        __asm volatile ("cpsid i\n msr BASEPRI,%0\n cpsie i"
-                        :: "r" (nvic_prio) : );
+    // current priority lower than the ceiling (or BASEPRI not set)?
+    if ((basepri_ == 0U) || (basepri_ > nvic_prio)) {
+        // NOTE: PRIMASK is saved and restored (not cleared by "cpsie i"),
+        // so the lock does not enable interrupts disabled by the caller
+        std::uint32_t primask_; // initialized in the following asm()
+        __asm volatile ("mrs %0,PRIMASK" : "=r" (primask_) :: );
+        __asm volatile ("cpsid i\n msr BASEPRI,%0\n msr PRIMASK,%1"
+                        :: "r" (nvic_prio), "r" (primask_) : "memory");
     }
     return basepri_;
 #endif
@@ -188,4 +253,34 @@ void Task::unlock(LockKey lock_key) {
 #endif
 }
 
+// SST stack facilities ------------------------------------------------------
+void stackPaint(void * const stackBottom, void * const stackTop) noexcept {
+    std::uint32_t *sp; // initialized in the following asm() instruction
+    __asm volatile ("mov %0,sp" : "=r" (sp) :: );
+
+    //! @pre the current stack pointer must be within the stack
+    DBC_REQUIRE(400, (stackBottom < sp) && (sp <= stackTop));
+
+    stack_bottom = static_cast<std::uint32_t *>(stackBottom);
+    stack_top    = static_cast<std::uint32_t *>(stackTop);
+
+    // NOTE: paint only below the current stack pointer, which is not used
+    // yet, but must not be used by interrupts during the painting either.
+    // Therefore, SST::stackPaint() should be called at the beginning of
+    // main(), before enabling interrupts.
+    for (std::uint32_t *p = stack_bottom; p < sp; ++p) {
+        *p = STACK_PAINT;
+    }
+}
+//............................................................................
+std::uint32_t stackUsed(void) noexcept {
+    // the stack grows down, so the deepest use is the lowest overwritten
+    // word above the stack bottom (the high watermark)
+    std::uint32_t const *p = stack_bottom;
+    while ((p < stack_top) && (*p == STACK_PAINT)) {
+        ++p;
+    }
+    return static_cast<std::uint32_t>(stack_top - p) * sizeof(*p);
+}
+
 } // namespace SST
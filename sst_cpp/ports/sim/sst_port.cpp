@@ -0,0 +1,255 @@
+//============================================================================
+// Super-Simple Tasker (SST/C++) port to the host (deterministic simulation)
+//
+// Copyright (C) 2006-2023 Quantum Leaps, <state-machine.com>.
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//============================================================================
+#include "sst.hpp"      // Super-Simple Tasker (SST/C++)
+#include "dbc_assert.h" // Design By Contract (DBC) assertions
+
+//............................................................................
+namespace { // unnamed namespace
+
+DBC_MODULE_NAME("sst_port") // for DBC assertions in this module
+
+static SST::Task *sim_tasks;        // list of all started tasks
+static SST::TaskPrio sim_prio;      // priority of the running task
+static SST::TaskPrio sim_ceiling;   // current scheduler-lock ceiling
+static std::uint_fast8_t sim_critNest; // critical section nesting
+static std::uint_fast8_t sim_isrNest;  // emulated interrupt nesting
+static bool sim_started;            // multitasking started?
+
+static std::uint32_t sim_clock;     // the virtual clock (SST timestamp)
+static void (*sim_isr)(void);       // periodic ISR (e.g., the system tick)
+static std::uint32_t sim_isrPeriod; // period of sim_isr in timestamps
+static std::uint32_t sim_isrDue;    // timestamp when sim_isr is due
+
+} // unnamed namespace
+
+namespace SST {
+
+// SST kernel facilities -----------------------------------------------------
+void init(void) {
+}
+//............................................................................
+void start(void) {
+    sim_started = true;
+    Task::simSchedule_(); // run the tasks pended before the start
+}
+
+// SST Task facilities -------------------------------------------------------
+void Task::setPrio(TaskPrio prio) noexcept {
+    //! @pre the priority must be greater than zero
+    DBC_REQUIRE(200, prio > 0U);
+
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    Task *t = sim_tasks;
+    while ((t != nullptr) && (t != this)) {
+        t = t->m_simNext;
+    }
+    if (t == nullptr) { // not registered yet?
+        m_simNext = sim_tasks;
+        sim_tasks = this;
+    }
+    m_prio = prio;
+    m_pend = false;
+    SST_PORT_CRIT_EXIT();
+}
+//............................................................................
+void Task::activate(void) {
+    //! @pre the queue must have some events
+    DBC_REQUIRE(300, m_nUsed > 0U);
+
+    // get the event out of the queue
+    // NOTE: no critical section because me->tail is accessed only
+    // from this task
+    Evt const *e = m_qBuf[m_tail];
+#ifdef SST_EVT_DEADLINE
+    Timestamp const dl = (m_dlBuf != nullptr) ? m_dlBuf[m_tail] : 0U;
+#endif
+#ifdef SST_LATENCY
+    LatencyStamp const stamp = (m_latBuf != nullptr)
+                               ? m_latBuf[m_tail] : LatencyStamp();
+#endif
+    if (m_tail == 0U) { // need to wrap the tail?
+        m_tail = m_end; // wrap around
+    }
+    else {
+        --m_tail;
+    }
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    // some events still present in the queue?
+    if ((--m_nUsed) > 0U) {
+        m_pend = true; // <=== pend this task again
+    }
+#ifdef SST_SIG_COALESCE
+    unpend_(e); // the signal no longer in the queue
+#endif
+#ifdef SST_QUEUE_WATERMARK
+    bool const resume = drained_();
+#endif
+    SST_PORT_CRIT_EXIT();
+#ifdef SST_QUEUE_WATERMARK
+    if (resume) { // drained to the low-watermark?
+        m_wmProducer->post(m_resumeEvt);
+    }
+#endif
+
+#ifdef SST_LATENCY
+    if (m_latBuf != nullptr) {
+        recordLatency_(e, stamp);
+    }
+#endif
+#ifdef SST_TASK_BUDGET
+    budgetEnter_();
+#endif
+    // dispatch the received event to this task
+    dispatch(e); // virtual call
+#ifdef SST_TASK_BUDGET
+    budgetExit_();
+#endif
+#ifdef SST_EVT_DEADLINE
+    if (dl != 0U) { // deadline to check?
+        checkDeadline_(e, dl);
+    }
+#endif
+#ifdef SST_EVT_POOL
+    gc(e); // recycle the event
+#endif
+}
+//............................................................................
+void Task::simSchedule_(void) { // static
+    if ((!sim_started) || (sim_critNest != 0U) || (sim_isrNest != 0U)) {
+        return; // scheduling not possible now
+    }
+    for (;;) {
+        // find the highest-priority pended task above the threshold
+        TaskPrio const threshold = (sim_ceiling > sim_prio)
+                                   ? sim_ceiling : sim_prio;
+        Task *next = nullptr;
+        for (Task *t = sim_tasks; t != nullptr; t = t->m_simNext) {
+            if (t->m_pend && (t->m_prio > threshold)
+                && ((next == nullptr) || (t->m_prio > next->m_prio)))
+            {
+                next = t;
+            }
+        }
+        if (next == nullptr) { // no task to run?
+            break;
+        }
+
+        // "preempt" the current priority level (like the NVIC would)
+        TaskPrio const prev = sim_prio;
+        next->m_pend = false;
+        sim_prio = next->m_prio;
+        next->activate(); // runs synchronously
+        sim_prio = prev;
+    }
+}
+
+//............................................................................
+LockKey Task::lock(TaskPrio ceiling) {
+    LockKey const key = sim_ceiling;
+    if (sim_ceiling < ceiling) { // current ceiling lower than the new one?
+        sim_ceiling = ceiling;
+    }
+    return key;
+}
+//............................................................................
+void Task::unlock(LockKey lock_key) {
+    sim_ceiling = static_cast<TaskPrio>(lock_key);
+    simSchedule_(); // run the tasks pended while locked
+}
+
+// SST host-simulation facilities --------------------------------------------
+void simCritEntry(void) noexcept {
+    ++sim_critNest;
+}
+//............................................................................
+void simCritExit(void) {
+    //! @pre must be inside a critical section
+    DBC_REQUIRE(400, sim_critNest > 0U);
+
+    if ((--sim_critNest) == 0U) {
+        Task::simSchedule_(); // tasks pended in the critical section
+    }
+}
+//............................................................................
+void simIsrEnter(void) noexcept {
+    ++sim_isrNest;
+}
+//............................................................................
+void simIsrExit(void) {
+    //! @pre must be inside an emulated interrupt
+    DBC_REQUIRE(500, sim_isrNest > 0U);
+
+    if ((--sim_isrNest) == 0U) {
+        Task::simSchedule_(); // tasks pended by the ISR
+    }
+}
+//............................................................................
+void simSetIsr(void (*isr)(void), std::uint32_t const period) noexcept {
+    //! @pre the ISR requires a non-zero period
+    DBC_REQUIRE(600, (isr == nullptr) || (period > 0U));
+
+    sim_isr       = isr;
+    sim_isrPeriod = period;
+    sim_isrDue    = sim_clock + period;
+}
+//............................................................................
+void simAdvance(std::uint32_t n) {
+    // NOTE: the periodic ISR "preempts" the caller whenever it becomes
+    // due, but it cannot preempt itself (an ISR calling simAdvance())
+    for (;;) {
+        if ((sim_isr != nullptr) && (sim_isrNest == 0U)) {
+            std::uint32_t const due = sim_isrDue - sim_clock;
+            if ((due == 0U) || (due > 0x7FFFFFFFU)) { // ISR (over)due?
+                sim_isrDue += sim_isrPeriod;
+                simIsrEnter();
+                (*sim_isr)();
+                simIsrExit();
+                continue;
+            }
+            if (due <= n) { // ISR due within the time to advance?
+                sim_clock += due;
+                n -= due;
+                continue;
+            }
+        }
+        sim_clock += n;
+        break;
+    }
+}
+//............................................................................
+std::uint32_t simTimestamp(void) noexcept {
+    return sim_clock;
+}
+
+//............................................................................
+std::uint16_t simContextId(void) noexcept {
+    return (sim_isrNest != 0U) ? SIM_ISR_CONTEXT
+                               : static_cast<std::uint16_t>(sim_prio);
+}
+
+} // namespace SST
@@ -0,0 +1,85 @@
+//============================================================================
+// Super-Simple Tasker (SST/C++) port to the host (deterministic simulation)
+//
+// Copyright (C) 2006-2023 Quantum Leaps, <state-machine.com>.
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//============================================================================
+#ifndef SST_PORT_HPP_
+#define SST_PORT_HPP_
+
+// NOTE:
+// This port runs SST on a host computer in a single thread and emulates
+// the prioritized preemption of the NVIC in software: a posted task runs
+// synchronously as soon as its priority exceeds the current priority and
+// the scheduler-lock ceiling, and no interrupt (SST::simIsrEnter()) and no
+// critical section is active. The SST timestamp is a virtual clock, which
+// advances only in SST::simAdvance(). Consequently, every run of the
+// application is exactly repeatable, which is suitable for testing.
+
+// additional SST-PORT task attributes for the host simulation
+#define SST_PORT_TASK_ATTR \
+    Task *m_simNext; \
+    TaskPrio m_prio; \
+    bool m_pend;
+
+// additional SST-PORT task operations for the host simulation
+#define SST_PORT_TASK_OPER \
+    void activate(void); \
+    void setPrio(TaskPrio prio) noexcept; \
+    static void simSchedule_(void);
+
+// SST-PORT critical section
+#define SST_PORT_CRIT_STAT
+#define SST_PORT_CRIT_ENTRY() SST::simCritEntry()
+#define SST_PORT_CRIT_EXIT()  SST::simCritExit()
+
+// SST-PORT pend the Task after posting an event
+// NOTE: executed inside SST critical section.
+//
+#define SST_PORT_TASK_PEND()  (m_pend = true)
+
+// SST-PORT timestamp from the virtual clock
+#define SST_PORT_TIMESTAMP()  (SST::simTimestamp())
+
+// SST-PORT ID of the current context (priority of the running task,
+// 0 for main(), or SST::SIM_ISR_CONTEXT in the emulated ISRs)
+#define SST_PORT_CONTEXT_ID() (SST::simContextId())
+
+namespace SST {
+    void onIdle(void);
+
+    //! SST lock key
+    using LockKey = std::uint32_t;
+
+    // host-simulation facilities
+    void simCritEntry(void) noexcept;
+    void simCritExit(void);
+    void simIsrEnter(void) noexcept;
+    void simIsrExit(void);
+    void simSetIsr(void (*isr)(void), std::uint32_t const period) noexcept;
+    void simAdvance(std::uint32_t n);
+    std::uint32_t simTimestamp(void) noexcept;
+    std::uint16_t simContextId(void) noexcept;
+    constexpr std::uint16_t SIM_ISR_CONTEXT = 0x100U;
+}
+
+#endif // SST_PORT_HPP_
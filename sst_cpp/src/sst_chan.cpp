@@ -0,0 +1,110 @@
+//============================================================================
+// Super-Simple Tasker (SST/C++)
+//
+// Copyright (C) 2006-2023 Quantum Leaps, <state-machine.com>.
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//============================================================================
+#include "sst_chan.hpp" // SST buffer channels
+#include "dbc_assert.h" // Design By Contract (DBC) assertions
+
+//............................................................................
+namespace { // unnamed namespace
+
+DBC_MODULE_NAME("sst_chan") // for DBC assertions in this module
+
+} // unnamed namespace
+
+namespace SST {
+
+//............................................................................
+BufChan::BufChan(void * const sto, std::uint32_t const blockSize,
+                 std::uint8_t const nBlocks,
+                 Task * const task, Evt const * const e)
+  : m_sto(static_cast<std::uint8_t *>(sto)),
+    m_task(task),
+    m_evt(e),
+    m_blockSize(blockSize),
+    m_nBlocks(nBlocks),
+    m_fill(0U),
+    m_rd(0U),
+    m_nReady(0U),
+    m_nOverruns(0U)
+{
+    //! @pre
+    //! - the storage must be provided for at least two blocks
+    //! - the consumer task and the event must be provided
+    DBC_REQUIRE(100,
+        (sto != nullptr) && (blockSize > 0U) && (nBlocks >= 2U)
+        && (task != nullptr) && (e != nullptr));
+
+    //! @pre the queue of the consumer task (if already started) must hold
+    //! all "block ready" events, so that swap() cannot overflow it
+    DBC_REQUIRE(110,
+        (task->getQLen() == 0U) || (task->getQLen() >= (nBlocks - 1U)));
+}
+//............................................................................
+bool BufChan::swap(void) noexcept {
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    // a free block for the producer after handing over the filled one?
+    bool const ok = (m_nReady < (m_nBlocks - 1U));
+    if (ok) {
+        ++m_nReady;
+        ++m_fill;
+        if (m_fill == m_nBlocks) {
+            m_fill = 0U; // wrap around
+        }
+    }
+    else { // overrun: drop the filled block and refill it
+        ++m_nOverruns;
+    }
+    SST_PORT_CRIT_EXIT();
+
+    if (ok) {
+        m_task->post(m_evt); // one "block ready" event per block
+    }
+    return ok;
+}
+//............................................................................
+void const *BufChan::acquire(void) const noexcept {
+    // NOTE: no critical section, because m_rd changes only in release()
+    // and the producer can only increase m_nReady
+    return (m_nReady != 0U) ? (m_sto + (m_rd * m_blockSize)) : nullptr;
+}
+//............................................................................
+void BufChan::release(void) noexcept {
+    //! @pre the consumer must hold a block
+    DBC_REQUIRE(200, m_nReady != 0U);
+
+    std::uint8_t rd = static_cast<std::uint8_t>(m_rd + 1U);
+    if (rd == m_nBlocks) {
+        rd = 0U; // wrap around
+    }
+    m_rd = rd;
+
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    --m_nReady; // give the block back to the producer
+    SST_PORT_CRIT_EXIT();
+}
+
+} // namespace SST
@@ -0,0 +1,127 @@
+//============================================================================
+// Super-Simple Tasker (SST/C++)
+//
+// Copyright (C) 2006-2023 Quantum Leaps, <state-machine.com>.
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//============================================================================
+#include "sst_hsm.hpp"  // SST hierarchical state machines
+#include "dbc_assert.h" // Design By Contract (DBC) assertions
+
+//............................................................................
+namespace { // unnamed namespace
+
+DBC_MODULE_NAME("sst_hsm") // for DBC assertions in this module
+
+} // unnamed namespace
+
+namespace SST {
+
+//............................................................................
+Hsm::Hsm(State const * const states) noexcept
+  : m_states(states),
+    m_tran(nullptr),
+    m_state(TOP)
+{}
+//............................................................................
+void Hsm::enterInitial(void) {
+    //! @pre
+    //! - the initial transition can be taken only once
+    //! - the top state must designate the initial state
+    DBC_REQUIRE(100,
+        (m_state == TOP)
+        && (m_states[TOP].init != TOP));
+
+    m_state = drill_(TOP);
+}
+//............................................................................
+void Hsm::dispatch(Evt const * const e) {
+    //! @pre the initial transition must have been taken
+    DBC_REQUIRE(200, m_state != TOP);
+
+    // propagate the event from the current state up the hierarchy
+    StateId s = m_state;
+    Status status = UNHANDLED;
+    do {
+        Handler const handler = m_states[s].handler;
+        if (handler != nullptr) {
+            status = (*handler)(this, e);
+        }
+        if (status == UNHANDLED) {
+            s = m_states[s].parent;
+        }
+    } while ((status == UNHANDLED) && (s != TOP));
+
+    if (status == TRAN) {
+        Tran const * const t = m_tran;
+
+        //! @pre the transition must be taken from the handling state
+        DBC_REQUIRE(210, (t != nullptr) && (t->source == s));
+
+        // exit the current state up to the transition source
+        for (s = m_state; s != t->source; s = m_states[s].parent) {
+            if (m_states[s].exit != nullptr) {
+                (*m_states[s].exit)(this);
+            }
+        }
+        // exit the precomputed number of states up to the LCA
+        for (std::uint_fast8_t n = t->nExit; n > 0U; --n) {
+            if (m_states[s].exit != nullptr) {
+                (*m_states[s].exit)(this);
+            }
+            s = m_states[s].parent;
+        }
+        // enter the precomputed states down to the target
+        for (std::uint_fast8_t n = 0U; n < t->nEntry; ++n) {
+            s = static_cast<StateId>(t->entry >> (8U * n));
+            if (m_states[s].entry != nullptr) {
+                (*m_states[s].entry)(this);
+            }
+        }
+        m_tran  = nullptr;
+        m_state = drill_(t->target);
+    }
+}
+//............................................................................
+bool Hsm::isIn(StateId const s) const noexcept {
+    for (StateId i = m_state; i != TOP; i = m_states[i].parent) {
+        if (i == s) {
+            return true;
+        }
+    }
+    return false;
+}
+//............................................................................
+Hsm::StateId Hsm::drill_(StateId s) {
+    // take the nested initial transitions down to the leaf state
+    for (StateId i = m_states[s].init; i != TOP; i = m_states[i].init) {
+        //! @pre the initial transition must target a direct substate
+        DBC_REQUIRE(300, m_states[i].parent == s);
+
+        if (m_states[i].entry != nullptr) {
+            (*m_states[i].entry)(this);
+        }
+        s = i;
+    }
+    return s;
+}
+
+} // namespace SST
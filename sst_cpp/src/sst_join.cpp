@@ -0,0 +1,82 @@
+//============================================================================
+// Super-Simple Tasker (SST/C++)
+//
+// Copyright (C) 2006-2023 Quantum Leaps, <state-machine.com>.
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//============================================================================
+#include "sst_join.hpp" // SST join barriers
+#include "dbc_assert.h" // Design By Contract (DBC) assertions
+
+//............................................................................
+namespace { // unnamed namespace
+
+DBC_MODULE_NAME("sst_join") // for DBC assertions in this module
+
+} // unnamed namespace
+
+namespace SST {
+
+//............................................................................
+JoinBarrier::JoinBarrier(Task * const coordinator, Evt const * const doneEvt)
+  : m_coordinator(coordinator),
+    m_doneEvt(doneEvt),
+    m_nPending(0U),
+    m_nFailed(0U)
+{
+    //! @pre the coordinator task and the "all done" event must be provided
+    DBC_REQUIRE(100, (coordinator != nullptr) && (doneEvt != nullptr));
+}
+//............................................................................
+void JoinBarrier::arm(std::uint16_t const n) noexcept {
+    //! @pre
+    //! - at least one completion must be expected
+    //! - the previous round must be complete
+    DBC_REQUIRE(200, (n > 0U) && (m_nPending == 0U));
+
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    m_nPending = n;
+    m_nFailed  = 0U;
+    SST_PORT_CRIT_EXIT();
+}
+//............................................................................
+void JoinBarrier::done(bool const ok) noexcept {
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    std::uint16_t const n = m_nPending;
+    if (n > 0U) { // test and decrement the same value atomically
+        m_nPending = static_cast<std::uint16_t>(n - 1U);
+        if (!ok) {
+            ++m_nFailed;
+        }
+    }
+    SST_PORT_CRIT_EXIT();
+
+    //! @pre the barrier must expect more completions
+    DBC_REQUIRE(300, n > 0U);
+
+    if (n == 1U) { // the last completion?
+        m_coordinator->post(m_doneEvt);
+    }
+}
+
+} // namespace SST
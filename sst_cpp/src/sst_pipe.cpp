@@ -0,0 +1,140 @@
+//============================================================================
+// Super-Simple Tasker (SST/C++)
+//
+// Copyright (C) 2006-2023 Quantum Leaps, <state-machine.com>.
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//============================================================================
+#include "sst_pipe.hpp" // SST pipelines
+#include "dbc_assert.h" // Design By Contract (DBC) assertions
+
+//............................................................................
+namespace { // unnamed namespace
+
+DBC_MODULE_NAME("sst_pipe") // for DBC assertions in this module
+
+} // unnamed namespace
+
+namespace SST {
+
+//............................................................................
+PipeLink::PipeLink(Task * const producer, Task * const consumer,
+                   QCtr const credits, Evt const * const creditEvt,
+                   Evt const ** const heldBuf, QCtr const heldLen)
+  : m_producer(producer),
+    m_consumer(consumer),
+    m_creditEvt(creditEvt),
+    m_heldBuf(heldBuf),
+    m_heldLen(heldLen),
+    m_heldHead(0U),
+    m_heldTail(0U),
+    m_nHeld(0U),
+    m_credits(credits),
+    m_maxCredits(credits),
+    m_nDropped(0U)
+{
+    //! @pre
+    //! - the consumer must be provided
+    //! - the link must have some credits
+    //! - the held-event buffer must be provided for non-zero length
+    //! - a producer task needs the credit event
+    DBC_REQUIRE(100,
+        (consumer != nullptr) && (credits > 0U)
+        && ((heldLen == 0U) || (heldBuf != nullptr))
+        && ((producer == nullptr) || (creditEvt != nullptr)));
+}
+//............................................................................
+PipeLink::Result PipeLink::send(Evt const * const e) noexcept {
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    Result res;
+    // deliver now only when no other events are held (keep the order)
+    if ((m_nHeld == 0U) && (m_credits > 0U)) {
+        --m_credits; // the consumer queue has room for this event
+        res = SENT;
+    }
+    else if (m_nHeld < m_heldLen) { // room to hold the event?
+        m_heldBuf[m_heldHead] = e;
+#ifdef SST_EVT_POOL
+        // NOTE: the link holds a reference to a buffer event, so that
+        // the producer's gc() after its dispatch() cannot recycle it
+        BlockPool::ref_(e); // released in done() after delivery
+#endif
+        ++m_heldHead;
+        if (m_heldHead == m_heldLen) {
+            m_heldHead = 0U; // wrap around
+        }
+        ++m_nHeld;
+        res = HELD;
+    }
+    else {
+        ++m_nDropped;
+#ifdef SST_EVT_POOL
+        // NOTE: the reference taken here and released by gc() below
+        // recycles a buffer event that is not held by any task
+        BlockPool::ref_(e);
+#endif
+        res = DROPPED;
+    }
+    SST_PORT_CRIT_EXIT();
+
+    if (res == SENT) {
+        m_consumer->post(e);
+    }
+#ifdef SST_EVT_POOL
+    else if (res == DROPPED) {
+        gc(e);
+    }
+#endif
+    return res;
+}
+//............................................................................
+void PipeLink::done(void) noexcept {
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    Evt const *held = nullptr;
+    if (m_nHeld != 0U) { // any held events? --> pass the credit to the oldest
+        held = m_heldBuf[m_heldTail];
+        ++m_heldTail;
+        if (m_heldTail == m_heldLen) {
+            m_heldTail = 0U; // wrap around
+        }
+        --m_nHeld;
+    }
+    else {
+        //! @pre the consumer must not return more credits than it received
+        DBC_REQUIRE(200, m_credits < m_maxCredits);
+        ++m_credits;
+    }
+    SST_PORT_CRIT_EXIT();
+
+    if (held != nullptr) {
+        m_consumer->post(held);
+#ifdef SST_EVT_POOL
+        gc(held); // release the reference held by the link
+#endif
+        if (m_producer != nullptr) {
+            m_producer->post(m_creditEvt); // "held event delivered"
+        }
+    }
+}
+
+} // namespace SST
@@ -0,0 +1,194 @@
+//============================================================================
+// Super-Simple Tasker (SST/C++)
+//
+// Copyright (C) 2006-2023 Quantum Leaps, <state-machine.com>.
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//============================================================================
+#include "sst_rpc.hpp"  // SST request/response messaging
+#include "dbc_assert.h" // Design By Contract (DBC) assertions
+
+//............................................................................
+namespace { // unnamed namespace
+
+DBC_MODULE_NAME("sst_rpc") // for DBC assertions in this module
+
+// holders of a request (RpcEvt::flags_)
+constexpr std::uint8_t RPC_APP    = (1U << 0U); // the client application
+constexpr std::uint8_t RPC_SERVER = (1U << 1U); // the server (in flight)
+constexpr std::uint8_t RPC_TIMER  = (1U << 2U); // the timeout (or its event)
+constexpr std::uint8_t RPC_HELD   = RPC_APP | RPC_SERVER | RPC_TIMER;
+// the request has timed out
+constexpr std::uint8_t RPC_EXPIRED = (1U << 3U);
+
+} // unnamed namespace
+
+namespace SST {
+
+//............................................................................
+void RpcPool::init(void * const sto, std::uint32_t const stoSize,
+                   std::uint32_t const evtSize,
+                   Task * const owner, Signal const tmoSig,
+                   TimeoutPool * const tmoPool)
+{
+    //! @pre
+    //! - the storage must be provided for at least one request
+    //! - the request size must fit RpcEvt and keep its alignment
+    //! - the client task must be provided
+    DBC_REQUIRE(100,
+        (sto != nullptr) && (evtSize >= sizeof(RpcEvt))
+        && ((evtSize % alignof(RpcEvt)) == 0U)
+        && (stoSize >= evtSize) && (owner != nullptr));
+
+    m_owner     = owner;
+    m_tmoPool   = tmoPool;
+    m_tmoSig    = tmoSig;
+    m_nextId    = 0U;
+    m_nTimeouts = 0U;
+
+    // chain all requests into the list of free requests
+    m_free  = nullptr;
+    m_nFree = 0U;
+    std::uint8_t *p = static_cast<std::uint8_t *>(sto);
+    for (std::uint32_t n = stoSize / evtSize; n > 0U; --n) {
+        free_(reinterpret_cast<RpcEvt *>(p));
+        p += evtSize;
+    }
+}
+//............................................................................
+RpcEvt *RpcPool::alloc(Signal const sig) noexcept {
+    RpcEvt * const req = m_free;
+    if (req != nullptr) {
+        m_free = req->next_;
+        --m_nFree;
+
+        req->sig     = sig;
+        req->replyTo = m_owner;
+        req->corrId  = m_nextId;
+        req->status  = 0U;
+        req->flags_  = RPC_APP;
+        req->next_   = nullptr;
+        req->tmo_    = 0U;
+        req->tmoEvt_.sig  = m_tmoSig;
+        req->tmoEvt_.call = req;
+        ++m_nextId;
+    }
+    return req; // nullptr when the pool is exhausted
+}
+//............................................................................
+bool RpcPool::call(Task * const server, RpcEvt * const req,
+                   TCtr const timeout) noexcept
+{
+    //! @pre the request must be allocated from this pool and not sent yet
+    DBC_REQUIRE(200,
+        (server != nullptr) && (req != nullptr)
+        && (req->replyTo == m_owner) && (req->flags_ == RPC_APP));
+
+    if ((timeout != 0U) && (m_tmoPool != nullptr)) {
+        req->tmo_ = m_tmoPool->arm(m_owner, &req->tmoEvt_, timeout);
+        if (req->tmo_ == 0U) { // no timeout available?
+            return false; // request not sent (still held by the client)
+        }
+        req->flags_ |= RPC_TIMER;
+    }
+    req->flags_ |= RPC_SERVER;
+    server->post(req);
+    return true;
+}
+//............................................................................
+RpcEvt const *RpcPool::complete(Evt const * const e) noexcept {
+    RpcEvt * const req = const_cast<RpcEvt *>(static_cast<RpcEvt const *>(e));
+
+    //! @pre the response must be a request of this pool in flight
+    DBC_REQUIRE(300,
+        (req->replyTo == m_owner) && ((req->flags_ & RPC_SERVER) != 0U));
+
+    req->flags_ &= static_cast<std::uint8_t>(~RPC_SERVER);
+    if ((req->flags_ & RPC_EXPIRED) != 0U) { // late response?
+        if ((req->flags_ & RPC_HELD) == 0U) {
+            free_(req);
+        }
+        return nullptr; // the client already got the timeout
+    }
+    if ((req->flags_ & RPC_TIMER) != 0U) {
+        // NOTE: the timeout event might be already posted, in which case
+        // the request stays allocated until expire() receives it
+        if (m_tmoPool->cancel(req->tmo_)) {
+            req->flags_ &= static_cast<std::uint8_t>(~RPC_TIMER);
+        }
+    }
+    return req; // to be released by release()
+}
+//............................................................................
+RpcEvt const *RpcPool::expire(Evt const * const e) noexcept {
+    RpcEvt * const req = static_cast<RpcTmoEvt const *>(e)->call;
+
+    //! @pre the timeout must belong to a request of this pool
+    DBC_REQUIRE(400,
+        (req->replyTo == m_owner) && ((req->flags_ & RPC_TIMER) != 0U));
+
+    req->flags_ &= static_cast<std::uint8_t>(~RPC_TIMER);
+    if ((req->flags_ & RPC_SERVER) == 0U) { // the response came first?
+        if ((req->flags_ & RPC_HELD) == 0U) {
+            free_(req);
+        }
+        return nullptr; // the timeout is stale
+    }
+    // the request is released when the late response arrives
+    req->flags_ = static_cast<std::uint8_t>(
+                      (req->flags_ & ~RPC_APP) | RPC_EXPIRED);
+    ++m_nTimeouts;
+    return req; // NOTE: only the signal and corrId are valid
+}
+//............................................................................
+void RpcPool::release(RpcEvt const * const rsp) noexcept {
+    RpcEvt * const req = const_cast<RpcEvt *>(rsp);
+
+    //! @pre the request must be held by the client and not in flight
+    DBC_REQUIRE(500,
+        (req != nullptr) && (req->replyTo == m_owner)
+        && ((req->flags_ & (RPC_APP | RPC_SERVER)) == RPC_APP));
+
+    req->flags_ &= static_cast<std::uint8_t>(~RPC_APP);
+    if ((req->flags_ & RPC_HELD) == 0U) {
+        free_(req);
+    }
+}
+//............................................................................
+void RpcPool::reply(RpcEvt const * const req, Signal const sig,
+                    std::uint8_t const status) noexcept
+{
+    // NOTE: the request event is reused for the response, which the
+    // server must not access after the reply
+    RpcEvt * const rsp = const_cast<RpcEvt *>(req);
+    rsp->sig    = sig;
+    rsp->status = status;
+    rsp->replyTo->post(rsp);
+}
+//............................................................................
+void RpcPool::free_(RpcEvt * const req) noexcept {
+    req->flags_ = 0U;
+    req->next_  = m_free;
+    m_free = req;
+    ++m_nFree;
+}
+
+} // namespace SST
@@ -0,0 +1,173 @@
+//============================================================================
+// Super-Simple Tasker (SST/C++)
+//
+// Copyright (C) 2006-2023 Quantum Leaps, <state-machine.com>.
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//============================================================================
+#include "sst_stream.hpp" // SST stream buffers
+#include "dbc_assert.h"   // Design By Contract (DBC) assertions
+
+#include <atomic> // for std::atomic_signal_fence()
+
+//............................................................................
+namespace { // unnamed namespace
+
+DBC_MODULE_NAME("sst_stream") // for DBC assertions in this module
+
+// compiler barrier between the data and the ring counters
+// NOTE: the producer and the consumer run on the same CPU, so only
+// the compiler reordering needs to be prevented
+inline void compilerBarrier(void) noexcept {
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+}
+
+} // unnamed namespace
+
+namespace SST {
+
+//............................................................................
+StreamBuf::StreamBuf(std::uint8_t * const sto, std::uint16_t const len,
+                     Task * const task, Evt const * const e,
+                     TickDomain const domain)
+  : m_sto(sto),
+    m_task(task),
+    m_evt(e),
+    m_idleCb(&idle_, this, domain),
+    m_mask(static_cast<std::uint16_t>(len - 1U)),
+    m_threshold(static_cast<std::uint16_t>(len / 2U)),
+    m_wr(0U),
+    m_rd(0U),
+    m_idleWr(0U),
+    m_pended(false),
+    m_nLost(0U)
+{
+    //! @pre
+    //! - the storage must be provided
+    //! - the length must be a power of 2 between 2 and 0x8000
+    //! - the consumer task and the event must be provided
+    DBC_REQUIRE(100,
+        (sto != nullptr)
+        && (1U < len) && (len <= 0x8000U) && ((len & (len - 1U)) == 0U)
+        && (task != nullptr) && (e != nullptr));
+}
+//............................................................................
+void StreamBuf::setThreshold(std::uint16_t const threshold) noexcept {
+    //! @pre the threshold must be between 1 and the buffer length
+    DBC_REQUIRE(200, (0U < threshold) && (threshold <= m_mask + 1U));
+
+    m_threshold = threshold;
+}
+//............................................................................
+void StreamBuf::setIdleTimeout(TCtr const ticks) {
+    if (ticks != 0U) {
+        m_idleCb.arm(ticks, ticks); // periodic idle-line check
+    }
+    else {
+        static_cast<void>(m_idleCb.disarm());
+    }
+}
+//............................................................................
+std::uint16_t StreamBuf::write(std::uint8_t const * const data,
+                               std::uint16_t const n) noexcept
+{
+    std::uint16_t const wr = m_wr;
+    std::uint16_t const nFree = static_cast<std::uint16_t>(
+        (m_mask + 1U) - static_cast<std::uint16_t>(wr - m_rd));
+    std::uint16_t const nWr = (n < nFree) ? n : nFree;
+
+    for (std::uint16_t i = 0U; i < nWr; ++i) {
+        m_sto[static_cast<std::uint16_t>(wr + i) & m_mask] = data[i];
+    }
+    compilerBarrier(); // the data must be written before m_wr
+    m_wr = static_cast<std::uint16_t>(wr + nWr);
+
+    m_nLost += static_cast<std::uint32_t>(n - nWr);
+    if (static_cast<std::uint16_t>(m_wr - m_rd) >= m_threshold) {
+        notify_();
+    }
+    return nWr;
+}
+//............................................................................
+bool StreamBuf::put(std::uint8_t const b) noexcept {
+    return write(&b, 1U) == 1U;
+}
+//............................................................................
+void StreamBuf::flush(void) noexcept {
+    if (m_wr != m_rd) { // any data to read?
+        notify_();
+    }
+}
+//............................................................................
+std::uint16_t StreamBuf::read(std::uint8_t * const buf,
+                              std::uint16_t const n) noexcept
+{
+    std::uint16_t const rd = m_rd;
+    std::uint16_t const nUsed = static_cast<std::uint16_t>(m_wr - rd);
+    std::uint16_t const nRd = (n < nUsed) ? n : nUsed;
+
+    compilerBarrier(); // m_wr must be read before the data
+    for (std::uint16_t i = 0U; i < nRd; ++i) {
+        buf[i] = m_sto[static_cast<std::uint16_t>(rd + i) & m_mask];
+    }
+    compilerBarrier(); // the data must be read before m_rd
+    m_rd = static_cast<std::uint16_t>(rd + nRd);
+
+    if (nRd < n) { // buffer emptied?
+        // NOTE: the producer could write more data in the meantime,
+        // which then would not notify the consumer anymore
+        SST_PORT_CRIT_STAT
+        SST_PORT_CRIT_ENTRY();
+        m_pended = false; // re-enable the notifications
+        bool const more = (static_cast<std::uint16_t>(m_wr - m_rd)
+                           >= m_threshold);
+        SST_PORT_CRIT_EXIT();
+        if (more) {
+            notify_();
+        }
+    }
+    return nRd;
+}
+//............................................................................
+void StreamBuf::notify_(void) noexcept {
+    // NOTE: the notification can come from the producer ISR, the idle
+    // check, and the consumer at the same time
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    bool const post = !m_pended;
+    m_pended = true;
+    SST_PORT_CRIT_EXIT();
+
+    if (post) {
+        m_task->post(m_evt);
+    }
+}
+//............................................................................
+void StreamBuf::idle_(void *par) { // static
+    StreamBuf * const me = static_cast<StreamBuf *>(par);
+    std::uint16_t const wr = me->m_wr;
+    if ((wr == me->m_idleWr) && (wr != me->m_rd)) { // idle with data?
+        me->notify_();
+    }
+    me->m_idleWr = wr;
+}
+
+} // namespace SST
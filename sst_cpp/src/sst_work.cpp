@@ -0,0 +1,118 @@
+//============================================================================
+// Super-Simple Tasker (SST/C++)
+//
+// Copyright (C) 2006-2023 Quantum Leaps, <state-machine.com>.
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//============================================================================
+#include "sst_work.hpp" // SST work queues
+#include "dbc_assert.h" // Design By Contract (DBC) assertions
+
+//............................................................................
+namespace { // unnamed namespace
+
+DBC_MODULE_NAME("sst_work") // for DBC assertions in this module
+
+} // unnamed namespace
+
+namespace SST {
+
+//............................................................................
+WorkQueue::WorkQueue(Item * const sto, QCtr const len)
+  : m_sto(sto),
+    m_len(len),
+    m_itemHead(0U),
+    m_itemTail(0U),
+    m_nItems(0U),
+    m_nMax(0U),
+    m_posted(false)
+{
+    //! @pre the storage for the work items must be provided
+    DBC_REQUIRE(100, (sto != nullptr) && (len > 0U));
+}
+//............................................................................
+void WorkQueue::start(TaskPrio prio) {
+    Task::start(prio, m_qSto, ARRAY_NELEM(m_qSto), nullptr);
+}
+//............................................................................
+bool WorkQueue::submit(WorkFn const fn, void * const arg) noexcept {
+    //! @pre the work function must be provided
+    DBC_REQUIRE(200, fn != nullptr);
+
+    static Evt const workEvt = { 0U };
+
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    if (m_nItems == m_len) { // no more room?
+        SST_PORT_CRIT_EXIT();
+        return false; // work item not submitted
+    }
+    m_sto[m_itemHead].fn  = fn;
+    m_sto[m_itemHead].arg = arg;
+    ++m_itemHead;
+    if (m_itemHead == m_len) {
+        m_itemHead = 0U; // wrap around
+    }
+    ++m_nItems;
+    if (m_nMax < m_nItems) {
+        m_nMax = m_nItems;
+    }
+    bool const idle = !m_posted;
+    m_posted = true;
+    SST_PORT_CRIT_EXIT();
+
+    // NOTE: the activation event is posted only when none is pending
+    // (dispatch() clears m_posted upon entry), so the queue of the task
+    // never holds more than one event
+    if (idle) {
+        post(&workEvt);
+    }
+    return true;
+}
+//............................................................................
+void WorkQueue::init(Evt const * const /*ie*/) {
+}
+//............................................................................
+void WorkQueue::dispatch(Evt const * const /*e*/) {
+    SST_PORT_CRIT_STAT
+    SST_PORT_CRIT_ENTRY();
+    m_posted = false; // the items submitted from now on need a new event
+    SST_PORT_CRIT_EXIT();
+
+    for (;;) { // run all the pending work items
+        SST_PORT_CRIT_ENTRY();
+        if (m_nItems == 0U) { // no more work?
+            SST_PORT_CRIT_EXIT();
+            break;
+        }
+        Item const item = m_sto[m_itemTail];
+        ++m_itemTail;
+        if (m_itemTail == m_len) {
+            m_itemTail = 0U; // wrap around
+        }
+        --m_nItems;
+        SST_PORT_CRIT_EXIT();
+
+        (*item.fn)(item.arg); // run the work item to completion
+    }
+}
+
+} // namespace SST
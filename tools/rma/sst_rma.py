@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+#=============================================================================
+# Response-time (RMA) schedulability analyzer for Super-Simple Tasker (SST)
+#
+# Copyright (C) 2006-2023 Quantum Leaps, <state-machine.com>.
+#
+# SPDX-License-Identifier: MIT
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+# THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+#=============================================================================
+"""
+Computes the worst-case response times of SST tasks and ISRs with the
+classic response-time analysis (RTA) for fixed-priority preemptive
+scheduling:
+
+    R = C + B + sum over higher-or-equal priority j of ceil((R+Jj)/Tj)*Cj
+
+where the blocking term B is the longest critical section of a lower
+priority task that locks the scheduler (SST::Task::lock()) with a ceiling
+at or above the priority of the analyzed task (Stack Resource Policy).
+
+ISRs preempt all SST tasks. Tasks at the same SST priority do not preempt
+each other, but are counted as interference (conservative).
+
+The "prio" of a task is its SST priority (1, 2, ..., higher is more
+urgent). The "prio" of an ISR is its NVIC priority (0 is the most urgent,
+as in the NVIC registers), so the ISRs are ordered the other way around.
+
+usage: sst_rma.py system.json [--measured times.csv] [--margin 0.8]
+"""
+
+import argparse
+import csv
+import json
+import math
+import sys
+
+ISR_LEVEL = 1000  # ISRs are above all SST task priorities
+NVIC_MAX_PRIO = 255  # the least urgent NVIC priority (ISR "prio")
+
+#-----------------------------------------------------------------------------
+def load_system(path):
+    with open(path) as f:
+        desc = json.load(f)
+    items = []
+    for kind in ("isrs", "tasks"):
+        for item in desc.get(kind, []):
+            it = dict(item)
+            it["kind"] = kind[:-1]
+            if kind == "isrs": # NVIC priority (0 is the most urgent)
+                it["level"] = ISR_LEVEL + (NVIC_MAX_PRIO - it["prio"])
+            else: # SST priority (higher is more urgent)
+                it["level"] = it["prio"]
+            it.setdefault("deadline", it["period"])
+            it.setdefault("jitter", 0)
+            it.setdefault("locks", [])
+            items.append(it)
+    return desc.get("time_unit", ""), items
+
+def apply_measured(items, path, factor):
+    # CSV lines: name,execution_time (one line per measured activation)
+    worst = {}
+    with open(path, newline="") as f:
+        for row in csv.reader(f):
+            if not row or row[0].startswith("#"):
+                continue
+            name, t = row[0].strip(), float(row[1])
+            worst[name] = max(worst.get(name, 0.0), t)
+    for it in items:
+        if it["name"] in worst:
+            it["wcet"] = worst[it["name"]] * factor
+
+def blocking(it, items):
+    # longest scheduler lock of a lower-priority task with ceiling >= prio
+    if it["kind"] == "isr":
+        return 0.0, None
+    b, by = 0.0, None
+    for lo in items:
+        if lo["kind"] != "task" or lo["prio"] >= it["prio"]:
+            continue
+        for lk in lo["locks"]:
+            if lk["ceiling"] >= it["prio"] and lk["wcet"] > b:
+                b, by = lk["wcet"], lo["name"]
+    return b, by
+
+def response_time(it, items):
+    hp = [j for j in items if j is not it and j["level"] >= it["level"]]
+    b, _ = blocking(it, items)
+    r = it["wcet"] + b
+    while True:
+        rn = it["wcet"] + b + sum(
+            math.ceil((r + j["jitter"]) / j["period"]) * j["wcet"]
+            for j in hp)
+        if rn == r:
+            return r + it["jitter"]
+        if rn + it["jitter"] > it["deadline"]:
+            return None  # diverges beyond the deadline
+        r = rn
+
+#-----------------------------------------------------------------------------
+def main():
+    parser = argparse.ArgumentParser(
+        description="SST response-time (RMA) schedulability analyzer")
+    parser.add_argument("system", help="JSON description of tasks and ISRs")
+    parser.add_argument("--measured", metavar="CSV",
+        help="measured execution times (name,time), the maximum is used")
+    parser.add_argument("--factor", type=float, default=1.0,
+        help="safety factor applied to the measured times (default 1.0)")
+    parser.add_argument("--margin", type=float, default=0.8,
+        help="flag response times above this fraction of the deadline")
+    args = parser.parse_args()
+
+    unit, items = load_system(args.system)
+    if args.measured:
+        apply_measured(items, args.measured, args.factor)
+
+    util = sum(it["wcet"] / it["period"] for it in items)
+    n = len(items)
+    bound = n * (2.0 ** (1.0 / n) - 1.0) if n > 0 else 1.0
+    print("utilization: %.3f (Liu-Layland bound for %d: %.3f)"
+          % (util, n, bound))
+    print("%-16s %-4s %5s %10s %10s %10s %10s %10s  %s" % ("name", "kind",
+          "prio", "period", "wcet", "block", "response", "deadline",
+          "status"))
+
+    status = 0
+    for it in sorted(items, key=lambda i: -i["level"]):
+        b, by = blocking(it, items)
+        r = response_time(it, items)
+        if r is None:
+            verdict, status = "MISS", 1
+            rs = "> D"
+        else:
+            rs = "%g" % r
+            if r > it["deadline"]:  # converged, but beyond the deadline
+                verdict, status = "MISS", 1
+            elif r > args.margin * it["deadline"]:
+                verdict = "RISK (>%d%% of deadline)" % (args.margin * 100)
+            else:
+                verdict = "ok"
+        if by is not None:
+            verdict += " blocked by %s" % by
+        print("%-16s %-4s %5d %10g %10g %10g %10s %10g  %s" % (it["name"],
+              it["kind"], it["prio"], it["period"], it["wcet"], b, rs,
+              it["deadline"], verdict))
+    if unit:
+        print("(all times in %s)" % unit)
+    return status
+
+if __name__ == "__main__":
+    sys.exit(main())
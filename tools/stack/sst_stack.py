@@ -0,0 +1,280 @@
+#!/usr/bin/env python3
+#=============================================================================
+# Worst-case shared-stack depth analyzer for Super-Simple Tasker (SST)
+#
+# Copyright (C) 2006-2023 Quantum Leaps, <state-machine.com>.
+#
+# SPDX-License-Identifier: MIT
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+# THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+#=============================================================================
+"""
+Computes the worst-case depth of the single stack shared by all SST tasks
+and ISRs. Every context (task or ISR) can be preempted only by contexts of
+strictly higher priority, and contexts at the same priority level do not
+preempt each other. Therefore, the worst case is the deepest activation
+at every priority level, stacked on top of each other:
+
+    total = main + sum over priority levels p of (frame + max depth at p)
+
+where "frame" is the exception frame pushed for every preemption (32 bytes
+on ARM Cortex-M, 104 bytes with the FPU context). In the non-preemptive
+SST0 ("kernel": "sst0") all tasks run from the main context and only
+the ISRs nest.
+
+The "prio" of a task is its SST priority (1, 2, ..., higher is more
+urgent). The "prio" of an ISR is its NVIC priority (0 is the most urgent,
+as in the NVIC registers), so the ISRs are ordered the other way around.
+
+The depth of a context is the deepest call path from its entry functions
+in the call graph generated by GCC (-fstack-usage -fcallgraph-info=su,
+files *.ci). Indirect calls (such as the virtual Task::dispatch() called
+from Task::activate()) must be resolved in the "calls" of the system
+description. Plain *.su files (-fstack-usage only) provide just the
+frame sizes, so all calls then need to be listed in "calls".
+
+usage: sst_stack.py system.json file.ci... [--limit bytes]
+"""
+
+import argparse
+import json
+import re
+import sys
+
+ISR_LEVEL = 1000  # ISRs are above all SST task priorities
+NVIC_MAX_PRIO = 255  # the least urgent NVIC priority (ISR "prio")
+
+#-----------------------------------------------------------------------------
+class CallGraph:
+    def __init__(self):
+        self.size = {}     # function -> frame size [bytes]
+        self.dynamic = set() # functions with unbounded dynamic frames
+        self.calls = {}    # function -> set of callees
+        self.alias = {}    # signature or qualified name -> functions
+        self.pretty = {}   # function -> qualified name (for printing)
+
+    def add_node(self, name, label, size, qual):
+        self.size[name] = max(self.size.get(name, 0), size)
+        if "dynamic" in qual and "bounded" not in qual:
+            self.dynamic.add(name)
+        self.calls.setdefault(name, set())
+        if label:
+            self.pretty.setdefault(name, short_name(label))
+            for a in (label, short_name(label)):
+                self.alias.setdefault(a, set()).add(name)
+
+    def load_ci(self, path):
+        # VCG graph emitted by GCC -fcallgraph-info=su
+        node_re = re.compile(r'node:\s*{\s*title:\s*"([^"]*)"\s*'
+                             r'label:\s*"([^"]*)"')
+        edge_re = re.compile(r'edge:\s*{\s*sourcename:\s*"([^"]*)"\s*'
+                             r'targetname:\s*"([^"]*)"')
+        with open(path) as f:
+            for line in f:
+                m = node_re.search(line)
+                if m:
+                    fields = m.group(2).split("\\n")
+                    size, qual = 0, ""
+                    if len(fields) >= 3:
+                        su = re.match(r"(\d+) bytes \(([^)]*)\)", fields[2])
+                        if su:
+                            size, qual = int(su.group(1)), su.group(2)
+                    if m.group(1) == "__indirect_call":
+                        continue
+                    self.add_node(m.group(1), fields[0], size, qual)
+                    continue
+                m = edge_re.search(line)
+                if m:
+                    self.calls.setdefault(m.group(1), set()).add(m.group(2))
+
+    def load_su(self, path):
+        # lines: file:line:col:signature<TAB>bytes<TAB>qualifiers
+        with open(path) as f:
+            for line in f:
+                parts = line.rstrip("\n").split("\t")
+                if len(parts) < 3:
+                    continue
+                sig = parts[0].split(":", 3)[-1]
+                self.add_node(sig, sig, int(parts[1]), parts[2])
+
+    def resolve(self, name):
+        if name in self.size:
+            return {name}
+        return self.alias.get(name, {name})
+
+def short_name(sig):
+    # "virtual void App::Blinky::dispatch(const SST::Evt*)" -> name only
+    depth, end = 0, len(sig)
+    for i, c in enumerate(sig):
+        if c in "<(":
+            if c == "(" and depth == 0 and not sig[:i].endswith("operator"):
+                end = i
+                break
+            depth += 1
+        elif c in ">)":
+            depth -= 1
+    head, depth, start = sig[:end], 0, 0
+    for i, c in enumerate(head):
+        if c == "<":
+            depth += 1
+        elif c == ">":
+            depth -= 1
+        elif c == " " and depth == 0:
+            start = i + 1
+    return head[start:]
+
+#-----------------------------------------------------------------------------
+class Context:
+    def __init__(self, item, kind, desc, graph):
+        self.name  = item["name"]
+        self.kind  = kind
+        self.prio  = item.get("prio", 0)
+        if kind == "isr": # NVIC priority (0 is the most urgent)
+            self.level = ISR_LEVEL + (NVIC_MAX_PRIO - self.prio)
+        else: # SST priority (higher is more urgent)
+            self.level = self.prio
+        self.entry = item["entry"]
+        self.graph = graph
+        self.extra = desc.get("extra", {})
+        self.calls = {}
+        for src in (desc.get("calls", {}), item.get("calls", {})):
+            for fn, callees in src.items():
+                for f in graph.resolve(fn):
+                    self.calls.setdefault(f, set()).update(callees)
+        self.warnings = set()
+        self.memo = {}
+
+    def callees(self, fn):
+        out = set()
+        for c in self.graph.calls.get(fn, set()) | self.calls.get(fn, set()):
+            out |= self.graph.resolve(c)
+        return out
+
+    def depth(self, fn, active=()):
+        # worst-case stack depth of fn and its callees, and the call path
+        if fn in self.memo:
+            return self.memo[fn]
+        if fn in active:
+            self.warnings.add("recursion through %s (not bounded)" % fn)
+            return 0, []
+        if fn in self.graph.size:
+            size = self.graph.size[fn]
+        elif fn in self.extra:
+            size = self.extra[fn]
+        else:
+            self.warnings.add("no stack usage for %s (counted as 0)" % fn)
+            size = 0
+        if fn in self.graph.dynamic:
+            self.warnings.add("unbounded dynamic stack in %s" % fn)
+        if fn in self.graph.calls and "__indirect_call" in \
+                self.graph.calls[fn] and fn not in self.calls:
+            self.warnings.add("unresolved indirect call in %s" % fn)
+        best, path = 0, []
+        for c in sorted(self.callees(fn)):
+            if c == "__indirect_call":
+                continue
+            d, p = self.depth(c, active + (fn,))
+            if d > best:
+                best, path = d, p
+        self.memo[fn] = (size + best, [fn] + path)
+        return self.memo[fn]
+
+    def worst(self):
+        best, path = 0, []
+        for e in self.entry:
+            for fn in sorted(self.graph.resolve(e)):
+                d, p = self.depth(fn)
+                if d > best:
+                    best, path = d, p
+        return best, path
+
+#-----------------------------------------------------------------------------
+def main():
+    parser = argparse.ArgumentParser(
+        description="SST worst-case shared-stack depth analyzer")
+    parser.add_argument("system",
+        help="JSON description of the tasks, ISRs and indirect calls")
+    parser.add_argument("files", nargs="+",
+        help="call graphs (*.ci) or stack usage (*.su) generated by GCC")
+    parser.add_argument("--limit", type=int, default=None,
+        help="size of the stack [bytes], fail if the worst case exceeds it")
+    parser.add_argument("--path", action="store_true",
+        help="print the deepest call path of every context")
+    args = parser.parse_args()
+
+    with open(args.system) as f:
+        desc = json.load(f)
+    graph = CallGraph()
+    for path in args.files:
+        if path.endswith(".su"):
+            graph.load_su(path)
+        else:
+            graph.load_ci(path)
+
+    frame = desc.get("frame", 32)
+    preemptive = (desc.get("kernel", "sst") != "sst0")
+    main_ctx = Context({"name": "main", "entry": desc.get("main", ["main"])},
+                       "main", desc, graph)
+    ctxs = [Context(it, kind[:-1], desc, graph)
+            for kind in ("isrs", "tasks") for it in desc.get(kind, [])]
+
+    print("%-16s %-4s %5s %8s  %s" % ("name", "kind", "prio", "depth",
+                                       "worst at level"))
+    main_depth, main_path = main_ctx.worst()
+    levels = {}  # level -> (depth, context)
+    for c in ctxs:
+        d, _ = c.worst()
+        if (c.kind == "task") and not preemptive:
+            main_depth = max(main_depth, d) # SST0 tasks run from main()
+            continue
+        if (c.level not in levels) or (d > levels[c.level][0]):
+            levels[c.level] = (d, c)
+
+    total = main_depth
+    for c in sorted([main_ctx] + ctxs, key=lambda i: -i.level):
+        d, p = c.worst()
+        worst = (c.kind != "main") and (levels.get(c.level, (0, None))[1]
+                                         is c)
+        print("%-16s %-4s %5d %8d  %s" % (c.name, c.kind, c.prio, d,
+              "*" if worst else ""))
+        if args.path and p:
+            print("    " + " -> ".join("%s(%d)" % (graph.pretty.get(fn, fn),
+                  graph.size.get(fn, c.extra.get(fn, 0))) for fn in p))
+    for lvl in levels:
+        total += frame + levels[lvl][0]
+
+    print("frames: %d x %d bytes, main context: %d bytes"
+          % (len(levels), frame, main_depth))
+    print("worst-case stack depth: %d bytes" % total)
+
+    status = 0
+    for c in [main_ctx] + ctxs:
+        for w in sorted(c.warnings):
+            print("warning (%s): %s" % (c.name, w))
+    if args.limit is not None:
+        if total > args.limit:
+            print("OVERFLOW: exceeds the stack size of %d bytes" % args.limit)
+            status = 1
+        else:
+            print("headroom: %d of %d bytes" % (args.limit - total,
+                  args.limit))
+    return status
+
+if __name__ == "__main__":
+    sys.exit(main())